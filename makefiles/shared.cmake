@@ -41,6 +41,11 @@ else()
     add_definitions(-DSEMVER="Local")
 endif()
 
+option(CSSHARP_TRACE "Compile trace logging into the core" ON)
+if(NOT CSSHARP_TRACE)
+    add_definitions(-DCSSHARP_DISABLE_TRACE)
+endif()
+
 if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
     add_compile_definitions(_GLIBCXX_USE_CXX11_ABI=0)
 endif()
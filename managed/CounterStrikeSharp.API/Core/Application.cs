@@ -72,6 +72,8 @@ namespace CounterStrikeSharp.API.Core
             _coreConfig.Load();
             _gameDataProvider.Load();
 
+            EntityWrapperCache.Initialize();
+
             var adminPath = Path.Combine(_scriptHostConfiguration.RootPath, "configs", "admins.json");
             Logger.LogInformation("Loading Admins from {Path}", adminPath);
             AdminManager.LoadAdminData(adminPath);
@@ -134,6 +136,8 @@ namespace CounterStrikeSharp.API.Core
                             plugin.Plugin?.ModuleVersion ?? "Unknown");
                         if (!string.IsNullOrEmpty(plugin.Plugin?.ModuleAuthor))
                             sb.AppendFormat(" by {0}", plugin.Plugin.ModuleAuthor);
+                        if (plugin.Plugin is BasePlugin { EntityDataStores.Count: > 0 } basePlugin)
+                            sb.AppendFormat(" [entity data: {0:N1} KiB]", EntityData.GetMemoryUsage(basePlugin.ModulePath) / 1024.0);
                         if (!string.IsNullOrEmpty(plugin.Plugin?.ModuleDescription))
                         {
                             sb.Append("\n");
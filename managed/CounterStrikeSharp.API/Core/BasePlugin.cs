@@ -132,6 +132,8 @@ namespace CounterStrikeSharp.API.Core
         public readonly List<CommandDefinition> CommandDefinitions = new List<CommandDefinition>();
 
         public readonly List<Timer> Timers = new List<Timer>();
+
+        public readonly List<EntityData> EntityDataStores = new List<EntityData>();
         
         public delegate HookResult GameEventHandler<T>(T @event, GameEventInfo info) where T : GameEvent;
 
@@ -357,6 +359,18 @@ namespace CounterStrikeSharp.API.Core
             return timer;
         }
 
+        /// <summary>
+        /// Allocates native per-entity storage for <typeparamref name="T"/> owned by this plugin.
+        /// The storage is released automatically when the plugin is unloaded.
+        /// </summary>
+        /// <returns>An instance of the <see cref="EntityData{T}"/></returns>
+        public EntityData<T> CreateEntityData<T>() where T : unmanaged
+        {
+            var entityData = new EntityData<T>(ModulePath);
+            EntityDataStores.Add(entityData);
+            return entityData;
+        }
+
         /// <summary>
         /// Registers all attribute handlers on the given instance.
         /// Can be used to register event handlers, console commands, entity outputs etc. from classes that are not derived from `BasePlugin`.
@@ -667,6 +681,11 @@ namespace CounterStrikeSharp.API.Core
                 timer.Kill();
             }
 
+            foreach (var entityData in EntityDataStores)
+            {
+                entityData.Dispose();
+            }
+
             _disposed = true;
         }
     }
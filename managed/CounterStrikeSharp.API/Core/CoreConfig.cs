@@ -61,6 +61,36 @@ namespace CounterStrikeSharp.API.Core
 
         [JsonPropertyName("UnlockConVars")]
         public bool UnlockConVars { get; set; } = true;
+
+        [JsonPropertyName("AuthCheckInterval")]
+        public float AuthCheckInterval { get; set; } = 0.1f;
+
+        [JsonPropertyName("CommandFloodRate")]
+        public float CommandFloodRate { get; set; } = 0;
+
+        [JsonPropertyName("CommandFloodBurst")]
+        public int CommandFloodBurst { get; set; } = 32;
+
+        [JsonPropertyName("AsyncLogging")]
+        public bool AsyncLogging { get; set; } = false;
+
+        [JsonPropertyName("AsyncLoggingQueueSize")]
+        public int AsyncLoggingQueueSize { get; set; } = 8192;
+
+        [JsonPropertyName("AsyncLoggingDropWhenFull")]
+        public bool AsyncLoggingDropWhenFull { get; set; } = false;
+
+        [JsonPropertyName("TraceCategories")]
+        public IEnumerable<string> TraceCategories { get; set; } = new List<string>();
+
+        [JsonPropertyName("TaskFrameBudget")]
+        public int TaskFrameBudget { get; set; } = 0;
+
+        [JsonPropertyName("JobThreadCount")]
+        public int JobThreadCount { get; set; } = 0;
+
+        [JsonPropertyName("JobAvoidGameThreadCores")]
+        public bool JobAvoidGameThreadCores { get; set; } = true;
     }
 
     /// <summary>
@@ -115,6 +145,56 @@ namespace CounterStrikeSharp.API.Core
 
         public static bool UnlockConVars => _coreConfig.UnlockConVars;
 
+        /// <summary>
+        /// Interval, in seconds, at which players still waiting for Steam authorization are re-checked. Defaults to <c>0.1</c>.
+        /// </summary>
+        public static float AuthCheckInterval => _coreConfig.AuthCheckInterval;
+
+        /// <summary>
+        /// Commands per second each client may send before excess commands are dropped, or <c>0</c> for no limit. Defaults to <c>0</c>.
+        /// </summary>
+        public static float CommandFloodRate => _coreConfig.CommandFloodRate;
+
+        /// <summary>
+        /// Number of commands a client may send in a single burst before <c>CommandFloodRate</c> applies. Defaults to <c>32</c>.
+        /// </summary>
+        public static int CommandFloodBurst => _coreConfig.CommandFloodBurst;
+
+        /// <summary>
+        /// When enabled, log messages are written by a background thread instead of on the game thread. Defaults to <c>false</c>.
+        /// </summary>
+        public static bool AsyncLogging => _coreConfig.AsyncLogging;
+
+        /// <summary>
+        /// Number of log messages that can wait to be written when <c>AsyncLogging</c> is enabled. Defaults to <c>8192</c>.
+        /// </summary>
+        public static int AsyncLoggingQueueSize => _coreConfig.AsyncLoggingQueueSize;
+
+        /// <summary>
+        /// When enabled, new log messages are dropped instead of waiting when the <c>AsyncLogging</c> queue is full. Defaults to <c>false</c>.
+        /// </summary>
+        public static bool AsyncLoggingDropWhenFull => _coreConfig.AsyncLoggingDropWhenFull;
+
+        /// <summary>
+        /// Trace log categories to enable, such as <c>events</c>, <c>hooks</c> or <c>all</c>. Defaults to an empty list.
+        /// </summary>
+        public static IEnumerable<string> TraceCategories => _coreConfig.TraceCategories;
+
+        /// <summary>
+        /// Time budget, in microseconds, for running queued next-frame tasks each frame, or <c>0</c> for no limit. Defaults to <c>0</c>.
+        /// </summary>
+        public static int TaskFrameBudget => _coreConfig.TaskFrameBudget;
+
+        /// <summary>
+        /// Number of threads in the native job pool, or <c>0</c> to pick one from the number of CPU cores. Defaults to <c>0</c>.
+        /// </summary>
+        public static int JobThreadCount => _coreConfig.JobThreadCount;
+
+        /// <summary>
+        /// When enabled, job threads are kept off the cores the game thread is pinned to. Defaults to <c>true</c>.
+        /// </summary>
+        public static bool JobAvoidGameThreadCores => _coreConfig.JobAvoidGameThreadCores;
+
     }
 
     public partial class CoreConfig : IStartupService
@@ -181,6 +181,16 @@ namespace CounterStrikeSharp.API.Core
             Remove(Identifier);
         }
 
+        /// <summary>
+        /// Releases a <see cref="FunctionLifetime.SingleUse"/> reference that will never be invoked,
+        /// and cancels its <see cref="CompletionTask"/>.
+        /// </summary>
+        internal void Cancel()
+        {
+            RemoveSelf();
+            _taskCompletionSource.TrySetCanceled();
+        }
+
         public static void Remove(int reference)
         {
             if (IdToFunctionReferencesMap.TryGetValue(reference, out var functionReference))
@@ -263,6 +263,12 @@ public partial class CCSPlayerController
         NativeAPI.IssueClientCommandFromServer(Slot, command);
     }
 
+    /// <summary>
+    /// Number of commands from this player that were dropped by the command flood limiter since they connected.
+    /// See <see cref="CoreConfig.CommandFloodRate"/> and <see cref="CoreConfig.CommandFloodBurst"/>.
+    /// </summary>
+    public int DroppedCommandCount => NativeAPI.GetClientDroppedCommandCount(Slot);
+
     /// <summary>
     /// Overrides who a player can hear in voice chat.
     /// </summary>
@@ -276,6 +282,20 @@ public partial class CCSPlayerController
         NativeAPI.SetClientListening(Handle, sender.Handle, (Byte)@override);
     }
 
+    /// <summary>
+    /// Replaces every listen override of this player in one call. Bit N of each mask refers to the player in slot N;
+    /// slots set in neither mask are reset to <see cref="ListenOverride.Default"/>.
+    /// </summary>
+    /// <param name="muteMask">Players this player should not hear</param>
+    /// <param name="hearMask">Players this player should always hear, unless also present in <paramref name="muteMask"/></param>
+    /// <exception cref="InvalidOperationException">Entity is not valid</exception>
+    public void SetListenOverrides(ulong muteMask, ulong hearMask)
+    {
+        Guard.IsValidEntity(this);
+
+        NativeAPI.SetClientListenMasks(Handle, muteMask, hearMask);
+    }
+
     /// <exception cref="InvalidOperationException">Entity is not valid</exception>
     public ListenOverride GetListenOverride(CCSPlayerController sender)
     {
@@ -0,0 +1,165 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+using System.Runtime.CompilerServices;
+using CounterStrikeSharp.API.Core;
+
+namespace CounterStrikeSharp.API.Modules.Entities;
+
+/// <summary>
+/// Non-generic base for <see cref="EntityData{T}"/>, used to track and release slots.
+/// </summary>
+public abstract unsafe class EntityData : IDisposable
+{
+    // Must match the chunk layout in entity_data_store.h.
+    private const uint InvalidRef = 0xFFFFFFFF;
+    private const uint IndexMask = 0x7FFF;
+    private const uint EntriesPerChunk = 512;
+    private const uint ChunkHeaderSize = EntriesPerChunk * sizeof(uint);
+
+    private bool _disposed;
+    private byte** _chunkTable;
+    private readonly uint _stride;
+
+    /// <summary>
+    /// Native slot id backing this store.
+    /// </summary>
+    public int Slot { get; }
+
+    /// <summary>
+    /// Key the slot was allocated under (the owning plugin's module path), used for memory reporting.
+    /// </summary>
+    public string Owner { get; }
+
+    protected EntityData(int size, string owner)
+    {
+        Owner = owner;
+        Slot = NativeAPI.AllocateEntityDataSlot(size, owner);
+        _chunkTable = (byte**)NativeAPI.GetEntityDataChunkTable(Slot);
+        _stride = (uint)(size + 7) & ~7u;
+    }
+
+    /// <summary>
+    /// Finds the stored entry for <paramref name="entityRef"/> by reading the native chunk table directly,
+    /// or returns null if there is none.
+    /// </summary>
+    protected byte* FindEntry(uint entityRef)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (entityRef == InvalidRef) return null;
+
+        var index = entityRef & IndexMask;
+        var chunk = _chunkTable[index / EntriesPerChunk];
+        if (chunk == null) return null;
+
+        // The entry may still belong to an older entity that used this index.
+        var entry = index % EntriesPerChunk;
+        if (((uint*)chunk)[entry] != entityRef) return null;
+
+        return chunk + ChunkHeaderSize + entry * _stride;
+    }
+
+    /// <summary>
+    /// Returns the number of bytes of native entity data currently allocated for the given owner,
+    /// or for every owner if <paramref name="owner"/> is empty.
+    /// </summary>
+    public static ulong GetMemoryUsage(string owner = "") => NativeAPI.GetEntityDataMemoryUsage(owner);
+
+    /// <summary>
+    /// Resets the stored value for the given entity back to its default.
+    /// </summary>
+    public void Clear(CEntityInstance entity)
+    {
+        NativeAPI.ClearEntityData(Slot, entity.EntityHandle.Raw);
+    }
+
+    public void Dispose()
+    {
+        if (_disposed) return;
+
+        NativeAPI.FreeEntityDataSlot(Slot);
+        _chunkTable = null;
+        _disposed = true;
+    }
+}
+
+/// <summary>
+/// Per-entity storage for a blittable <typeparamref name="T"/>, kept natively and indexed by entity index.
+/// Values are tied to the entity handle they were written for, and are reset automatically when the entity is deleted,
+/// so there is no need to clean up on round end or entity removal.
+/// <example>
+/// <code>
+/// private EntityData&lt;int&gt; _jumps = null!;
+///
+/// public override void Load(bool hotReload)
+/// {
+///     _jumps = CreateEntityData&lt;int&gt;();
+/// }
+///
+/// // Somewhere else
+/// _jumps[pawn]++;
+/// </code>
+/// </example>
+/// </summary>
+/// <typeparam name="T">Unmanaged value type to store</typeparam>
+public sealed class EntityData<T> : EntityData where T : unmanaged
+{
+    public EntityData(string owner) : base(Unsafe.SizeOf<T>(), owner)
+    {
+    }
+
+    /// <summary>
+    /// Returns a reference to the value stored for <paramref name="entity"/>, creating a zeroed entry if there is none.
+    /// Existing entries are read straight from native memory; only the first access for an entity calls into native code.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">Entity is not valid</exception>
+    public unsafe ref T this[CEntityInstance entity]
+    {
+        get
+        {
+            var entityRef = entity.EntityHandle.Raw;
+            var entry = FindEntry(entityRef);
+            if (entry == null)
+            {
+                // Native code checks that the entity exists before claiming the entry for it.
+                entry = (byte*)NativeAPI.GetEntityData(Slot, entityRef, true);
+                if (entry == null)
+                {
+                    throw new InvalidOperationException("Entity is not valid");
+                }
+            }
+
+            return ref Unsafe.AsRef<T>(entry);
+        }
+    }
+
+    /// <summary>
+    /// Reads the value stored for <paramref name="entity"/> without creating an entry.
+    /// </summary>
+    /// <returns><see langword="true"/> if a value has been stored for this entity</returns>
+    public unsafe bool TryGetValue(CEntityInstance entity, out T value)
+    {
+        var entry = FindEntry(entity.EntityHandle.Raw);
+        if (entry == null)
+        {
+            value = default;
+            return false;
+        }
+
+        value = Unsafe.Read<T>(entry);
+        return true;
+    }
+}
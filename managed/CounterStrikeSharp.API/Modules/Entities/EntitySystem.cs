@@ -8,6 +8,7 @@ namespace CounterStrikeSharp.API.Modules.Entities;
 public static class EntitySystem
 {
     private static Lazy<IntPtr> ConcreteEntityListPointer = new(NativeAPI.GetConcreteEntityListPointer);
+    private static Lazy<short> EntityIdentityOffset = new(() => Schema.GetSchemaOffset("CEntityInstance", "m_pEntity"));
 
     private const int MaxEntities = 32768;
     private const int MaxEntitiesPerChunk = 512;
@@ -21,33 +22,39 @@ public static class EntitySystem
 
     public static IntPtr? GetEntityByHandle(uint raw)
     {
-        return GetEntityByHandle(new CHandle<CEntityInstance>(raw));
-    }
-
-    public static IntPtr? GetEntityByHandle<T>(CHandle<T> handle) where T : NativeEntity
-    {
-        if (!handle.IsValid)
+        var index = raw & (Utilities.MaxEdicts - 1);
+        if (index == Utilities.MaxEdicts - 1)
             return null;
 
-        IntPtr pChunkToUse = IdentityChunks[(int)(handle.Index / MaxEntitiesPerChunk)];
+        IntPtr pChunkToUse = IdentityChunks[(int)(index / MaxEntitiesPerChunk)];
         if (pChunkToUse == IntPtr.Zero)
             return null;
 
-        IntPtr pIdentityPtr = IntPtr.Add(pChunkToUse, SizeOfEntityIdentity * (int)(handle.Index % MaxEntitiesPerChunk));
+        IntPtr pIdentityPtr = IntPtr.Add(pChunkToUse, SizeOfEntityIdentity * (int)(index % MaxEntitiesPerChunk));
 
         if (pIdentityPtr == IntPtr.Zero)
             return null;
 
-        var foundHandle = new CEntityHandle(pIdentityPtr + HandleOffset);
-
-        if (foundHandle.Raw != handle.Raw)
+        if ((uint)Marshal.ReadInt32(pIdentityPtr + HandleOffset) != raw)
             return null;
 
         return Marshal.ReadIntPtr(pIdentityPtr);
     }
 
+    public static IntPtr? GetEntityByHandle<T>(CHandle<T> handle) where T : NativeEntity
+    {
+        return GetEntityByHandle(handle.Raw);
+    }
+
     public static IntPtr? GetEntityByIndex(uint index)
     {
+        return GetEntityByIndex(index, out _);
+    }
+
+    internal static IntPtr? GetEntityByIndex(uint index, out uint raw)
+    {
+        raw = InvalidEHandleIndex;
+
         if ((int)index <= -1 || index >= MaxEntities - 1) return null;
 
         IntPtr pChunkToUse = IdentityChunks[(int)(index / MaxEntitiesPerChunk)];
@@ -59,20 +66,37 @@ public static class EntitySystem
         if (pIdentityPtr == IntPtr.Zero)
             return null;
 
-        var foundHandle = new CEntityHandle(pIdentityPtr + HandleOffset);
+        var foundRaw = (uint)Marshal.ReadInt32(pIdentityPtr + HandleOffset);
 
-        if (foundHandle.Index != index)
+        if ((foundRaw & (Utilities.MaxEdicts - 1)) != index)
             return null;
 
+        raw = foundRaw;
         return Marshal.ReadIntPtr(pIdentityPtr);
     }
 
+    /// <summary>
+    /// Returns the (cached) managed wrapper for the entity instance referenced by an entity identity pointer.
+    /// </summary>
+    internal static T? GetEntityFromIdentity<T>(IntPtr pIdentity) where T : NativeObject
+    {
+        var pEntity = Marshal.ReadIntPtr(pIdentity);
+        if (pEntity == IntPtr.Zero)
+            return null;
+
+        var raw = (uint)Marshal.ReadInt32(pIdentity + HandleOffset);
+        return EntityWrapperCache.GetOrCreate<T>(raw, pEntity);
+    }
+
     public static uint GetRawHandleFromEntityPointer(IntPtr pointer)
     {
         if (pointer == IntPtr.Zero)
             return InvalidEHandleIndex;
 
-        return Schema.GetPointer<CEntityIdentity?>(pointer, "CEntityInstance", "m_pEntity")?.EntityHandle.Raw ??
-               InvalidEHandleIndex;
+        var pIdentity = Marshal.ReadIntPtr(pointer + EntityIdentityOffset.Value);
+        if (pIdentity == IntPtr.Zero)
+            return InvalidEHandleIndex;
+
+        return (uint)Marshal.ReadInt32(pIdentity + HandleOffset);
     }
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+using System.Threading;
+using CounterStrikeSharp.API.Core;
+
+namespace CounterStrikeSharp.API.Modules.Entities;
+
+/// <summary>
+/// Caches managed entity wrappers by entity index so that repeated lookups of the same entity
+/// (e.g. <see cref="Utilities.GetEntityFromIndex{T}"/> or <see cref="Utils.CHandle{T}.Value"/> inside an OnTick loop)
+/// hand back the same instance instead of allocating a new one each time.
+/// </summary>
+/// <remarks>
+/// Every lookup is validated against the entity's current raw handle, so a slot re-used by a new entity
+/// (different serial number) is never confused with the old one. Slots are also cleared eagerly from the
+/// native OnEntityDeleted listener so that wrappers for deleted entities can be collected.
+/// </remarks>
+internal static class EntityWrapperCache
+{
+    private const int EntriesPerChunk = 512;
+    private const int ChunkCount = Utilities.MaxEdicts / EntriesPerChunk;
+
+    private sealed class Entry
+    {
+        public readonly uint Raw;
+        public readonly IntPtr Pointer;
+        public readonly NativeObject Instance;
+
+        public Entry(uint raw, IntPtr pointer, NativeObject instance)
+        {
+            Raw = raw;
+            Pointer = pointer;
+            Instance = instance;
+        }
+    }
+
+    /// <summary>
+    /// One table per wrapper type, as the same entity can be viewed as e.g. both
+    /// <see cref="CBaseEntity"/> and <see cref="CCSPlayerPawn"/>.
+    /// </summary>
+    private static class Table<T> where T : NativeObject
+    {
+        public static readonly Entry?[]?[] Chunks = Register();
+
+        private static Entry?[]?[] Register()
+        {
+            var chunks = new Entry?[ChunkCount][];
+            lock (AllTables)
+            {
+                AllTables.Add(chunks);
+            }
+
+            return chunks;
+        }
+    }
+
+    private static readonly List<Entry?[]?[]> AllTables = new();
+    private static FunctionReference? _onEntityDeleted;
+
+    internal static void Initialize()
+    {
+        if (_onEntityDeleted != null) return;
+
+        _onEntityDeleted = FunctionReference.Create((ScriptContext context) =>
+        {
+            var raw = EntitySystem.GetRawHandleFromEntityPointer(context.GetArgument<IntPtr>(0));
+            if (raw != Utilities.InvalidEHandleIndex)
+            {
+                Invalidate(raw & (Utilities.MaxEdicts - 1));
+            }
+        });
+
+        NativeAPI.AddListener("OnEntityDeleted", _onEntityDeleted);
+    }
+
+    /// <summary>
+    /// Returns the cached wrapper for the entity with the given raw handle, creating one if the slot is
+    /// empty or belongs to a different entity.
+    /// </summary>
+    public static T GetOrCreate<T>(uint raw, IntPtr pointer) where T : NativeObject
+    {
+        var index = raw & (Utilities.MaxEdicts - 1);
+        var chunk = Table<T>.Chunks[index / EntriesPerChunk];
+
+        if (chunk == null)
+        {
+            chunk = new Entry?[EntriesPerChunk];
+            chunk = Interlocked.CompareExchange(ref Table<T>.Chunks[index / EntriesPerChunk], chunk, null) ?? chunk;
+        }
+
+        var entry = chunk[index % EntriesPerChunk];
+        if (entry != null && entry.Raw == raw && entry.Pointer == pointer)
+        {
+            return (T)entry.Instance;
+        }
+
+        var instance = (T)Activator.CreateInstance(typeof(T), pointer)!;
+        chunk[index % EntriesPerChunk] = new Entry(raw, pointer, instance);
+        return instance;
+    }
+
+    public static void Invalidate(uint index)
+    {
+        if (index >= Utilities.MaxEdicts) return;
+
+        lock (AllTables)
+        {
+            foreach (var chunks in AllTables)
+            {
+                var chunk = chunks[index / EntriesPerChunk];
+                if (chunk != null)
+                {
+                    chunk[index % EntriesPerChunk] = null;
+                }
+            }
+        }
+    }
+}
@@ -67,6 +67,72 @@ public abstract class BaseMemoryFunction : NativeObject
         NativeAPI.UnhookFunction(Handle, handler, mode == HookMode.Post);
     }
 
+    /// <summary>
+    /// Adds a condition that is checked natively before <paramref name="handler"/> is invoked.
+    /// Calls that fail any condition added for the handler skip it entirely, without entering managed code.
+    /// <example>
+    /// <code>
+    /// // Only called when the victim is a player pawn
+    /// VirtualFunctions.CBaseEntity_TakeDamageOldFunc.Hook(OnTakeDamage, HookMode.Pre);
+    /// VirtualFunctions.CBaseEntity_TakeDamageOldFunc.AddHookFilter(OnTakeDamage, HookMode.Pre, 0, "player");
+    /// </code>
+    /// </example>
+    /// </summary>
+    /// <param name="handler">Handler previously passed to <see cref="Hook"/></param>
+    /// <param name="mode">Hook mode the handler was registered with</param>
+    /// <param name="paramIndex">Index of the parameter to test</param>
+    /// <param name="op">Comparison to apply</param>
+    /// <param name="value">Value to compare the parameter against</param>
+    public void AddHookFilter(Func<DynamicHook, HookResult> handler, HookMode mode, int paramIndex, HookFilterOperator op,
+        double value)
+    {
+        NativeAPI.AddFunctionHookFilter(Handle, handler, mode == HookMode.Post, paramIndex, (int)op, value, (long)value, "");
+    }
+
+    /// <inheritdoc cref="AddHookFilter(Func{DynamicHook, HookResult}, HookMode, int, HookFilterOperator, double)"/>
+    /// <remarks>Integer parameters are compared exactly, including 64-bit values and flag masks.</remarks>
+    public void AddHookFilter(Func<DynamicHook, HookResult> handler, HookMode mode, int paramIndex, HookFilterOperator op,
+        long value)
+    {
+        NativeAPI.AddFunctionHookFilter(Handle, handler, mode == HookMode.Post, paramIndex, (int)op, value, value, "");
+    }
+
+    /// <inheritdoc cref="AddHookFilter(Func{DynamicHook, HookResult}, HookMode, int, HookFilterOperator, double)"/>
+    /// <remarks>Integer parameters are compared exactly, including 64-bit values and flag masks.</remarks>
+    public void AddHookFilter(Func<DynamicHook, HookResult> handler, HookMode mode, int paramIndex, HookFilterOperator op,
+        ulong value)
+    {
+        NativeAPI.AddFunctionHookFilter(Handle, handler, mode == HookMode.Post, paramIndex, (int)op, value, unchecked((long)value), "");
+    }
+
+    /// <summary>
+    /// Adds a condition that <paramref name="handler"/> is only invoked when the pointer parameter at
+    /// <paramref name="paramIndex"/> is an entity with the given designer name.
+    /// </summary>
+    public void AddHookFilter(Func<DynamicHook, HookResult> handler, HookMode mode, int paramIndex, string designerName)
+    {
+        NativeAPI.AddFunctionHookFilter(Handle, handler, mode == HookMode.Post, paramIndex, (int)HookFilterOperator.Classname,
+            0, 0, designerName);
+    }
+
+    /// <summary>
+    /// Removes every filter added for <paramref name="handler"/>. Filters are also removed when the handler is unhooked.
+    /// </summary>
+    public void ClearHookFilters(Func<DynamicHook, HookResult> handler, HookMode mode)
+    {
+        NativeAPI.ClearFunctionHookFilters(Handle, handler, mode == HookMode.Post);
+    }
+
+    /// <summary>
+    /// Number of handler invocations skipped by hook filters on this function.
+    /// </summary>
+    public ulong FilteredCallCount => NativeAPI.GetFunctionHookCallCount(Handle, true);
+
+    /// <summary>
+    /// Number of handler invocations on this function that passed their filters and were dispatched.
+    /// </summary>
+    public ulong DispatchedCallCount => NativeAPI.GetFunctionHookCallCount(Handle, false);
+
     protected T InvokeInternal<T>(params object[] args)
     {
         return NativeAPI.ExecuteVirtualFunction<T>(Handle, args);
@@ -1,4 +1,5 @@
 using System;
+using System.Runtime.CompilerServices;
 using CounterStrikeSharp.API.Core;
 
 namespace CounterStrikeSharp.API.Modules.Memory.DynamicFunctions;
@@ -75,4 +76,52 @@ public class DynamicHook : NativeObject
     public T GetRegister<T>(DHookRegister registerId) {
         return NativeAPI.DynamicHookGetRegister<T>(Handle, (int)registerId, (int)typeof(T).ToValidDataType());
     }
+
+    /// <summary>
+    /// Copies every parameter of the hooked call, followed by the return value, into <paramref name="destination"/>
+    /// in a single native call. Each slot holds the value in its low bytes; use <see cref="FromSlot{T}"/> to read it.
+    /// <example>
+    /// <code>
+    /// Span&lt;ulong&gt; slots = stackalloc ulong[3]; // 2 parameters + return value
+    /// hook.CopyParams(slots);
+    /// var victim = DynamicHook.FromSlot&lt;IntPtr&gt;(slots[0]);
+    /// </code>
+    /// </example>
+    /// </summary>
+    /// <param name="destination">Buffer with at least one slot per parameter plus one for the return value</param>
+    /// <returns>Number of slots written</returns>
+    public unsafe int CopyParams(Span<ulong> destination)
+    {
+        fixed (ulong* pointer = destination)
+        {
+            return NativeAPI.DynamicHookGetParams(Handle, (IntPtr)pointer, destination.Length);
+        }
+    }
+
+    /// <summary>
+    /// Writes back the parameters selected by <paramref name="mask"/> from a buffer laid out like <see cref="CopyParams"/>.
+    /// Bit N selects parameter N, and the bit after the last parameter selects the return value.
+    /// </summary>
+    public unsafe void WriteParams(ReadOnlySpan<ulong> source, ulong mask)
+    {
+        fixed (ulong* pointer = source)
+        {
+            NativeAPI.DynamicHookSetParams(Handle, (IntPtr)pointer, source.Length, mask);
+        }
+    }
+
+    /// <summary>
+    /// Reinterprets a slot filled by <see cref="CopyParams"/> as <typeparamref name="T"/>.
+    /// </summary>
+    public static T FromSlot<T>(ulong slot) where T : unmanaged => Unsafe.As<ulong, T>(ref slot);
+
+    /// <summary>
+    /// Stores <paramref name="value"/> in a slot for <see cref="WriteParams"/>.
+    /// </summary>
+    public static ulong ToSlot<T>(T value) where T : unmanaged
+    {
+        ulong slot = 0;
+        Unsafe.As<ulong, T>(ref slot) = value;
+        return slot;
+    }
 }
@@ -0,0 +1,24 @@
+namespace CounterStrikeSharp.API.Modules.Memory.DynamicFunctions;
+
+/// <summary>
+/// Comparison applied natively to a hooked function parameter, see <see cref="BaseMemoryFunction.AddHookFilter"/>.
+/// </summary>
+public enum HookFilterOperator
+{
+    Equal = 0,
+    NotEqual = 1,
+    Less = 2,
+    LessOrEqual = 3,
+    Greater = 4,
+    GreaterOrEqual = 5,
+
+    /// <summary>
+    /// Passes when any of the bits in the value are set in the parameter.
+    /// </summary>
+    HasFlags = 6,
+
+    /// <summary>
+    /// Passes when the pointer parameter is an entity with the given designer name.
+    /// </summary>
+    Classname = 7,
+}
@@ -0,0 +1,32 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+
+namespace CounterStrikeSharp.API.Modules.Timers
+{
+    /// <summary>
+    /// Scheduling class for tasks queued with <see cref="Server.NextFrame(System.Action, TaskPriority)"/>
+    /// and <see cref="Server.NextWorldUpdate(System.Action, TaskPriority)"/>.
+    /// When <c>TaskFrameBudget</c> is set in core.json, lower priority tasks may be deferred to a later frame
+    /// once the budget is spent; <see cref="High"/> tasks always run on the frame they are due.
+    /// </summary>
+    public enum TaskPriority
+    {
+        High = 0,
+        Normal = 1,
+        Low = 2
+    }
+}
@@ -67,11 +67,12 @@ public class CHandle<T> : IEquatable<CHandle<T>> where T : NativeEntity
         if (!IsValid)
             return null;
 
-        var entity = EntitySystem.GetEntityByHandle(this);
+        var raw = Raw;
+        var entity = EntitySystem.GetEntityByHandle(raw);
         if (entity == null)
             return null;
 
-        return (T)Activator.CreateInstance(typeof(T), entity)!;
+        return EntityWrapperCache.GetOrCreate<T>(raw, entity.Value);
     }
 
     public override string ToString() => IsValid ? $"Index = {Index}, Serial = {SerialNum}" : "<invalid>";
@@ -115,6 +116,8 @@ public class CEntityHandle : CHandle<CEntityInstance>
 
 public class PointerTo<T> : NativeObject where T : NativeObject
 {
+    private static readonly bool IsEntity = typeof(NativeEntity).IsAssignableFrom(typeof(T));
+
     public PointerTo(IntPtr pointer) : base(pointer)
     {
     }
@@ -125,7 +128,18 @@ public class PointerTo<T> : NativeObject where T : NativeObject
         {
             unsafe
             {
-                return (T)Activator.CreateInstance(typeof(T), Unsafe.Read<IntPtr>((void*)Handle));
+                var pointer = Unsafe.Read<IntPtr>((void*)Handle);
+
+                if (IsEntity && pointer != IntPtr.Zero)
+                {
+                    var raw = EntitySystem.GetRawHandleFromEntityPointer(pointer);
+                    if (raw != Utilities.InvalidEHandleIndex)
+                    {
+                        return EntityWrapperCache.GetOrCreate<T>(raw, pointer);
+                    }
+                }
+
+                return (T)Activator.CreateInstance(typeof(T), pointer);
             }
         }
     }
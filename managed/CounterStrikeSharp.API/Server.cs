@@ -22,6 +22,7 @@ using System.Runtime.InteropServices;
 using System.Threading.Tasks;
 using CounterStrikeSharp.API.Core;
 using CounterStrikeSharp.API.Modules.Memory;
+using CounterStrikeSharp.API.Modules.Timers;
 using CounterStrikeSharp.API.Modules.Utils;
 
 namespace CounterStrikeSharp.API
@@ -95,7 +96,7 @@ namespace CounterStrikeSharp.API
         }
 
         /// <summary>
-        /// <inheritdoc cref="NextFrame"/>
+        /// <inheritdoc cref="NextFrame(Action)"/>
         /// Returns Task that completes once the synchronous task has been completed.
         /// </summary>
         public static Task NextFrameAsync(Action task)
@@ -115,7 +116,28 @@ namespace CounterStrikeSharp.API
         }
 
         /// <summary>
-        /// <inheritdoc cref="NextWorldUpdate"/>
+        /// <inheritdoc cref="NextFrame(Action, TaskPriority)"/>
+        /// Returns Task that completes once the synchronous task has been completed.
+        /// </summary>
+        public static Task NextFrameAsync(Action task, TaskPriority priority)
+        {
+            var functionReference = FunctionReference.Create(task, FunctionLifetime.SingleUse);
+            NativeAPI.QueueTaskForNextFrameWithPriority((int)priority, functionReference);
+            return functionReference.CompletionTask;
+        }
+
+        /// <summary>
+        /// Queue a task to be executed on the next game frame with the given priority.
+        /// Tasks below <see cref="TaskPriority.High"/> may be deferred to a later frame when the frame task budget is exhausted.
+        /// <remarks>Does not execute if the server is hibernating.</remarks>
+        /// </summary>
+        public static void NextFrame(Action task, TaskPriority priority)
+        {
+            NextFrameAsync(task, priority);
+        }
+
+        /// <summary>
+        /// <inheritdoc cref="NextWorldUpdate(Action)"/>
         /// Returns Task that completes once the synchronous task has been completed.
         /// </summary>
         public static Task NextWorldUpdateAsync(Action task)
@@ -135,6 +157,81 @@ namespace CounterStrikeSharp.API
             NextWorldUpdateAsync(task);
         }
 
+        /// <summary>
+        /// <inheritdoc cref="NextWorldUpdate(Action, TaskPriority)"/>
+        /// Returns Task that completes once the synchronous task has been completed.
+        /// </summary>
+        public static Task NextWorldUpdateAsync(Action task, TaskPriority priority)
+        {
+            var functionReference = FunctionReference.Create(task, FunctionLifetime.SingleUse);
+            NativeAPI.QueueTaskForNextWorldUpdateWithPriority((int)priority, functionReference);
+            return functionReference.CompletionTask;
+        }
+
+        /// <summary>
+        /// Queue a task to be executed on the next pre world update with the given priority.
+        /// Tasks below <see cref="TaskPriority.High"/> may be deferred to a later update when the frame task budget is exhausted.
+        /// <remarks>Executes if the server is hibernating.</remarks>
+        /// </summary>
+        public static void NextWorldUpdate(Action task, TaskPriority priority)
+        {
+            NextWorldUpdateAsync(task, priority);
+        }
+
+        /// <summary>
+        /// <inheritdoc cref="QueueJob"/>
+        /// Returns Task that completes once <paramref name="continuation"/> has run, or <paramref name="work"/> if there is no continuation.
+        /// The Task is cancelled if the job system shuts down before <paramref name="work"/> has started.
+        /// </summary>
+        public static Task QueueJobAsync(Action work, Action? continuation = null)
+        {
+            var workReference = FunctionReference.Create(work, FunctionLifetime.SingleUse);
+            var continuationReference =
+                continuation == null ? null : FunctionReference.Create(continuation, FunctionLifetime.SingleUse);
+
+            // Invoked instead of the job if it is still queued when the job system stops.
+            var discardReference = FunctionReference.Create(() =>
+            {
+                workReference.Cancel();
+                continuationReference?.Cancel();
+            }, FunctionLifetime.SingleUse);
+            workReference.CompletionTask.ContinueWith(_ => FunctionReference.Remove(discardReference.Identifier),
+                TaskContinuationOptions.OnlyOnRanToCompletion | TaskContinuationOptions.ExecuteSynchronously);
+
+            try
+            {
+                if (continuationReference == null)
+                {
+                    NativeAPI.QueueJob(workReference, discardReference);
+                    return workReference.CompletionTask;
+                }
+
+                NativeAPI.QueueJobWithContinuation(workReference, continuationReference, discardReference);
+                return continuationReference.CompletionTask;
+            }
+            catch
+            {
+                // The job was never queued (e.g. the job system is not running), so none of the references will be invoked.
+                workReference.Cancel();
+                continuationReference?.Cancel();
+                discardReference.Cancel();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Queue CPU-heavy work to run on the native job thread pool instead of the game thread.
+        /// <paramref name="work"/> runs on a job thread and must not touch game state; use <paramref name="continuation"/>,
+        /// which runs on the game thread on the frame after <paramref name="work"/> finishes, to apply the results.
+        /// <remarks>The number of job threads is set by <c>JobThreadCount</c> in core.json.</remarks>
+        /// </summary>
+        /// <param name="work">Work to run on a job thread</param>
+        /// <param name="continuation">Optional callback to run on the game thread once <paramref name="work"/> is done</param>
+        public static void QueueJob(Action work, Action? continuation = null)
+        {
+            QueueJobAsync(work, continuation);
+        }
+
         public static void PrintToChatAll(string message)
         {
             VirtualFunctions.ClientPrintAll(HudDestination.Chat, message, 0, 0, 0, 0);
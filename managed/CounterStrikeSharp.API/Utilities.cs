@@ -44,13 +44,13 @@ namespace CounterStrikeSharp.API
 
         public static T? GetEntityFromIndex<T>(int index) where T : CEntityInstance
         {
-            var entityPtr = EntitySystem.GetEntityByIndex((uint)index);
+            var entityPtr = EntitySystem.GetEntityByIndex((uint)index, out var raw);
             if (entityPtr is null || entityPtr == IntPtr.Zero)
             {
                 return null;
             }
 
-            return (T)Activator.CreateInstance(typeof(T), entityPtr)!;
+            return EntityWrapperCache.GetOrCreate<T>(raw, entityPtr.Value);
         }
 
         public static T? CreateEntityByName<T>(string name) where T : CBaseEntity
@@ -130,7 +130,9 @@ namespace CounterStrikeSharp.API
             for (; pEntity != null && pEntity.Handle != IntPtr.Zero; pEntity = pEntity.Next)
             {
                 if (pEntity.DesignerName == null || !pEntity.DesignerName.Contains(designerName)) continue;
-                yield return new PointerTo<T>(pEntity.Handle).Value;
+
+                var entity = EntitySystem.GetEntityFromIdentity<T>(pEntity.Handle);
+                if (entity != null) yield return entity;
             }
         }
 
@@ -139,10 +141,102 @@ namespace CounterStrikeSharp.API
             var pEntity = new CEntityIdentity(EntitySystem.FirstActiveEntity);
             for (; pEntity != null && pEntity.Handle != IntPtr.Zero; pEntity = pEntity.Next)
             {
-                yield return new PointerTo<CEntityInstance>(pEntity.Handle).Value;
+                var entity = EntitySystem.GetEntityFromIdentity<CEntityInstance>(pEntity.Handle);
+                if (entity != null) yield return entity;
             }
         }
 
+        /// <summary>
+        /// Returns entities whose absolute origin is within <paramref name="radius"/> units of <paramref name="origin"/>.
+        /// Backed by a native spatial index, so the full entity list is not walked.
+        /// </summary>
+        /// <param name="origin">Centre of the search sphere</param>
+        /// <param name="radius">Search radius</param>
+        /// <param name="designerName">Optional exact designer name to filter by, e.g. <c>"player"</c></param>
+        /// <param name="maxResults">Upper bound on the number of returned entities</param>
+        public static List<T> FindEntitiesInRadius<T>(Vector origin, float radius, string? designerName = null, int maxResults = 256)
+            where T : CEntityInstance
+        {
+            var indices = new uint[maxResults];
+            var count = FindEntityIndicesInRadius(origin, radius, indices, designerName);
+            return EntitiesFromIndices<T>(indices.AsSpan(0, count));
+        }
+
+        /// <summary>
+        /// Returns entities whose absolute origin lies inside the axis-aligned box <paramref name="mins"/>..<paramref name="maxs"/>.
+        /// </summary>
+        public static List<T> FindEntitiesInBox<T>(Vector mins, Vector maxs, string? designerName = null, int maxResults = 256)
+            where T : CEntityInstance
+        {
+            var indices = new uint[maxResults];
+            var count = FindEntityIndicesInBox(mins, maxs, indices, designerName);
+            return EntitiesFromIndices<T>(indices.AsSpan(0, count));
+        }
+
+        /// <summary>
+        /// Returns up to <paramref name="count"/> entities closest to <paramref name="origin"/>, nearest first.
+        /// </summary>
+        /// <param name="maxDistance">Ignore entities further away than this; zero or less searches the whole map</param>
+        public static List<T> FindNearestEntities<T>(Vector origin, int count, float maxDistance = 0.0f, string? designerName = null)
+            where T : CEntityInstance
+        {
+            var indices = new uint[count];
+            var found = FindNearestEntityIndices(origin, indices, maxDistance, designerName);
+            return EntitiesFromIndices<T>(indices.AsSpan(0, found));
+        }
+
+        /// <summary>
+        /// Allocation-free variant of <see cref="FindEntitiesInRadius{T}"/> that writes entity indices into <paramref name="results"/>.
+        /// </summary>
+        /// <returns>Number of indices written</returns>
+        public static unsafe int FindEntityIndicesInRadius(Vector origin, float radius, Span<uint> results, string? designerName = null)
+        {
+            fixed (uint* pResults = results)
+            {
+                return NativeAPI.QueryEntitiesInSphere(origin.Handle, radius, designerName ?? string.Empty, (IntPtr)pResults,
+                    results.Length);
+            }
+        }
+
+        /// <summary>
+        /// Allocation-free variant of <see cref="FindEntitiesInBox{T}"/> that writes entity indices into <paramref name="results"/>.
+        /// </summary>
+        /// <returns>Number of indices written</returns>
+        public static unsafe int FindEntityIndicesInBox(Vector mins, Vector maxs, Span<uint> results, string? designerName = null)
+        {
+            fixed (uint* pResults = results)
+            {
+                return NativeAPI.QueryEntitiesInBox(mins.Handle, maxs.Handle, designerName ?? string.Empty, (IntPtr)pResults,
+                    results.Length);
+            }
+        }
+
+        /// <summary>
+        /// Allocation-free variant of <see cref="FindNearestEntities{T}"/> that writes entity indices into <paramref name="results"/>, nearest first.
+        /// </summary>
+        /// <returns>Number of indices written</returns>
+        public static unsafe int FindNearestEntityIndices(Vector origin, Span<uint> results, float maxDistance = 0.0f,
+            string? designerName = null)
+        {
+            fixed (uint* pResults = results)
+            {
+                return NativeAPI.QueryNearestEntities(origin.Handle, maxDistance, designerName ?? string.Empty, (IntPtr)pResults,
+                    results.Length);
+            }
+        }
+
+        private static List<T> EntitiesFromIndices<T>(ReadOnlySpan<uint> indices) where T : CEntityInstance
+        {
+            var entities = new List<T>(indices.Length);
+            foreach (var index in indices)
+            {
+                var entity = GetEntityFromIndex<T>((int)index);
+                if (entity != null) entities.Add(entity);
+            }
+
+            return entities;
+        }
+
         /// <summary>
         /// Returns a list of <see cref="CCSPlayerController"/> that are valid and have a valid <see cref="CCSPlayerController.UserId"/> >= 0
         /// </summary>
@@ -0,0 +1,174 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/async_log_sink.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace counterstrikesharp {
+
+namespace {
+constexpr auto kFlushInterval = std::chrono::seconds(1);
+constexpr auto kIdleSleep = std::chrono::milliseconds(5);
+} // namespace
+
+AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, std::size_t queueSize, bool dropWhenFull)
+    : m_sinks(std::move(sinks)), m_dropWhenFull(dropWhenFull)
+{
+    // Values from core.json are not trusted to be sensible.
+    queueSize = std::clamp<std::size_t>(queueSize, 2, std::size_t{ 1 } << 20);
+
+    std::size_t capacity = 2;
+    while (capacity < queueSize)
+    {
+        capacity <<= 1;
+    }
+
+    m_slots = std::make_unique<Slot[]>(capacity);
+    m_mask = capacity - 1;
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_thread = std::thread(&AsyncLogSink::Run, this);
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) m_thread.join();
+}
+
+void AsyncLogSink::log(const spdlog::details::log_msg& msg)
+{
+    while (!TryEnqueue(msg))
+    {
+        if (m_dropWhenFull)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+
+    // Released after the message is queued, so a writer that sees the request also sees the message.
+    if (msg.level >= spdlog::level::warn) m_flushRequested.store(true, std::memory_order_release);
+}
+
+void AsyncLogSink::flush() { m_flushRequested.store(true, std::memory_order_release); }
+
+// The wrapped sinks keep their own patterns; they are formatted on the writer thread.
+void AsyncLogSink::set_pattern(const std::string&) {}
+
+void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter>) {}
+
+bool AsyncLogSink::TryEnqueue(const spdlog::details::log_msg& msg)
+{
+    // Bounded multi-producer queue (Vyukov): each slot's sequence says whose turn it is, so producers only contend on
+    // the enqueue position.
+    auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;)
+    {
+        slot = &m_slots[pos & m_mask];
+        const auto sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->message.emplace(msg);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    // Approximate, since the writer may have moved on, but good enough to size the queue from.
+    const auto depth = pos + 1 - std::min(pos + 1, m_dequeuePosSnapshot.load(std::memory_order_relaxed));
+    auto highWater = m_highWater.load(std::memory_order_relaxed);
+    while (depth > highWater && !m_highWater.compare_exchange_weak(highWater, depth, std::memory_order_relaxed))
+    {
+    }
+
+    return true;
+}
+
+bool AsyncLogSink::TryDequeue(spdlog::details::log_msg_buffer& msg)
+{
+    auto& slot = m_slots[m_dequeuePos & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) return false;
+
+    msg = std::move(*slot.message);
+    slot.message.reset();
+    slot.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos++;
+    m_dequeuePosSnapshot.store(m_dequeuePos, std::memory_order_relaxed);
+    return true;
+}
+
+void AsyncLogSink::Run()
+{
+    auto lastFlush = std::chrono::steady_clock::now();
+    spdlog::details::log_msg_buffer msg;
+    bool unflushed = false;
+
+    for (;;)
+    {
+        // Read before draining, so everything logged before shutdown is written.
+        const bool running = m_running.load(std::memory_order_acquire);
+        // Also taken before draining: a request that arrives after this is left set for the next pass, instead of being
+        // consumed before the message that raised it has been written.
+        const bool flushRequested = m_flushRequested.exchange(false, std::memory_order_acquire);
+
+        bool wrote = false;
+        while (TryDequeue(msg))
+        {
+            for (auto& sink : m_sinks)
+            {
+                if (sink->should_log(msg.level)) sink->log(msg);
+            }
+            wrote = true;
+        }
+
+        unflushed |= wrote;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (unflushed && (flushRequested || now - lastFlush >= kFlushInterval || !running))
+        {
+            for (auto& sink : m_sinks)
+            {
+                sink->flush();
+            }
+            lastFlush = now;
+            unflushed = false;
+        }
+
+        if (!running) break;
+        if (!wrote) std::this_thread::sleep_for(kIdleSleep);
+    }
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,82 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+namespace counterstrikesharp {
+
+/**
+ * Sink that hands messages to a writer thread, which formats them and writes them to the wrapped sinks.
+ *
+ * Messages go through a bounded lock-free queue, so logging from the game thread only copies the message. When the
+ * queue is full the message is either dropped and counted, or the caller waits for space. The wrapped sinks are flushed
+ * after warnings and errors, and otherwise at least once a second.
+ */
+class AsyncLogSink : public spdlog::sinks::sink
+{
+  public:
+    AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, std::size_t queueSize, bool dropWhenFull);
+    ~AsyncLogSink() override;
+
+    void log(const spdlog::details::log_msg& msg) override;
+    void flush() override;
+    void set_pattern(const std::string& pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+    const std::vector<spdlog::sink_ptr>& GetSinks() const { return m_sinks; }
+    std::uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+    std::size_t GetHighWaterMark() const { return m_highWater.load(std::memory_order_relaxed); }
+
+  private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        std::optional<spdlog::details::log_msg_buffer> message;
+    };
+
+    bool TryEnqueue(const spdlog::details::log_msg& msg);
+    bool TryDequeue(spdlog::details::log_msg_buffer& msg);
+    void Run();
+
+    std::vector<spdlog::sink_ptr> m_sinks;
+    bool m_dropWhenFull;
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_mask;
+    alignas(64) std::atomic<std::size_t> m_enqueuePos{ 0 };
+    alignas(64) std::size_t m_dequeuePos = 0;
+    // Published copy of m_dequeuePos, which only the writer thread touches, for the high-water mark.
+    std::atomic<std::size_t> m_dequeuePosSnapshot{ 0 };
+
+    std::atomic<std::uint64_t> m_dropped{ 0 };
+    std::atomic<std::size_t> m_highWater{ 0 };
+    std::atomic<bool> m_flushRequested{ false };
+    std::atomic<bool> m_running{ true };
+    std::thread m_thread;
+};
+
+} // namespace counterstrikesharp
@@ -0,0 +1,132 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace counterstrikesharp {
+
+/**
+ * Open-addressing hash map keyed by ASCII case-folded strings.
+ *
+ * Lookups take a string_view and never allocate or insert; keys are stored lower-cased along with
+ * their hash so a probe only compares strings whose hashes already match. Entries are never
+ * removed, which matches how commands are tracked (a removed command keeps its info with a null
+ * command pointer).
+ */
+template <typename T> class CaseInsensitiveHashMap
+{
+  public:
+    T* Find(std::string_view key)
+    {
+        if (m_buckets.empty()) return nullptr;
+
+        auto hash = Hash(key);
+        for (size_t i = hash & (m_buckets.size() - 1);; i = (i + 1) & (m_buckets.size() - 1))
+        {
+            auto& bucket = m_buckets[i];
+            if (!bucket.used) return nullptr;
+            if (bucket.hash == hash && Equals(bucket.key, key)) return &bucket.value;
+        }
+    }
+
+    T& Insert(std::string_view key, T value)
+    {
+        if (auto existing = Find(key))
+        {
+            *existing = value;
+            return *existing;
+        }
+
+        // Keep the load factor at or below 1/2 so probe sequences stay short.
+        if ((m_count + 1) * 2 > m_buckets.size()) Grow();
+
+        auto hash = Hash(key);
+        auto& bucket = Probe(hash);
+        bucket.used = true;
+        bucket.hash = hash;
+        bucket.key.resize(key.size());
+        std::transform(key.begin(), key.end(), bucket.key.begin(), [](char c) { return Fold(c); });
+        bucket.value = value;
+        m_count++;
+
+        return bucket.value;
+    }
+
+  private:
+    struct Bucket
+    {
+        bool used = false;
+        uint32_t hash = 0;
+        std::string key;
+        T value{};
+    };
+
+    static char Fold(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+    static uint32_t Hash(std::string_view key)
+    {
+        uint32_t hash = 0x811C9DC5;
+        for (char c : key)
+        {
+            hash = (hash ^ static_cast<uint8_t>(Fold(c))) * 0x01000193;
+        }
+        return hash;
+    }
+
+    static bool Equals(const std::string& folded, std::string_view key)
+    {
+        if (folded.size() != key.size()) return false;
+
+        for (size_t i = 0; i < key.size(); i++)
+        {
+            if (folded[i] != Fold(key[i])) return false;
+        }
+        return true;
+    }
+
+    Bucket& Probe(uint32_t hash)
+    {
+        for (size_t i = hash & (m_buckets.size() - 1);; i = (i + 1) & (m_buckets.size() - 1))
+        {
+            if (!m_buckets[i].used) return m_buckets[i];
+        }
+    }
+
+    void Grow()
+    {
+        std::vector<Bucket> old = std::move(m_buckets);
+        m_buckets = std::vector<Bucket>(old.empty() ? 64 : old.size() * 2);
+
+        for (auto& bucket : old)
+        {
+            if (!bucket.used) continue;
+            Probe(bucket.hash) = std::move(bucket);
+        }
+    }
+
+    std::vector<Bucket> m_buckets;
+    size_t m_count = 0;
+};
+
+} // namespace counterstrikesharp
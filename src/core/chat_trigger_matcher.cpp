@@ -0,0 +1,64 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/chat_trigger_matcher.h"
+
+#include <cstdint>
+
+namespace counterstrikesharp {
+
+void ChatTriggerMatcher::Compile(const std::vector<std::string>& triggers)
+{
+    m_triggers = triggers;
+    for (auto& bucket : m_buckets)
+    {
+        bucket.clear();
+    }
+
+    for (size_t i = 0; i < m_triggers.size(); i++)
+    {
+        if (m_triggers[i].empty())
+        {
+            // An empty trigger matches every message, so it has to be tried from every bucket.
+            for (auto& bucket : m_buckets)
+            {
+                bucket.push_back(i);
+            }
+            continue;
+        }
+
+        m_buckets[static_cast<uint8_t>(m_triggers[i][0])].push_back(i);
+    }
+}
+
+bool ChatTriggerMatcher::Match(std::string_view message, std::string_view& prefix) const
+{
+    auto firstByte = message.empty() ? 0 : static_cast<uint8_t>(message[0]);
+
+    for (auto i : m_buckets[firstByte])
+    {
+        const auto& trigger = m_triggers[i];
+        if (message.substr(0, trigger.size()) == trigger)
+        {
+            prefix = trigger;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace counterstrikesharp
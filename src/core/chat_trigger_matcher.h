@@ -0,0 +1,42 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace counterstrikesharp {
+
+/**
+ * Chat trigger set compiled for prefix matching. Triggers are bucketed by their first byte so a chat
+ * line only compares against triggers that can possibly match it, in the order they were configured.
+ */
+class ChatTriggerMatcher
+{
+  public:
+    void Compile(const std::vector<std::string>& triggers);
+    bool Match(std::string_view message, std::string_view& prefix) const;
+
+  private:
+    std::vector<std::string> m_triggers;
+    std::array<std::vector<size_t>, 256> m_buckets;
+};
+
+} // namespace counterstrikesharp
@@ -0,0 +1,87 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/command_flood_limiter.h"
+
+#include <algorithm>
+
+#include <tier0/platform.h>
+
+#include "core/coreconfig.h"
+#include "core/globals.h"
+#include "core/log.h"
+
+namespace counterstrikesharp {
+
+bool CommandFloodLimiter::TryConsume(int slot)
+{
+    if (m_bypass || slot < 0 || slot >= kMaxSlots) return true;
+
+    const auto rate = globals::coreConfig->CommandFloodRate;
+    const auto burst = static_cast<float>(std::max(globals::coreConfig->CommandFloodBurst, 1));
+    if (rate <= 0.0f) return true;
+
+    auto& bucket = m_buckets[slot];
+    const auto now = Plat_FloatTime();
+
+    if (bucket.tokens < 0.0f)
+    {
+        bucket.tokens = burst;
+    }
+    else
+    {
+        bucket.tokens = std::min(burst, bucket.tokens + static_cast<float>((now - bucket.lastRefill) * rate));
+    }
+    bucket.lastRefill = now;
+
+    bucket.limited = bucket.tokens < 1.0f;
+    if (!bucket.limited)
+    {
+        bucket.tokens -= 1.0f;
+        return true;
+    }
+
+    if (bucket.dropped++ == 0)
+    {
+        CSSHARP_CORE_WARN("Client in slot {} is flooding commands, dropping excess commands", slot);
+    }
+    m_totalDropped++;
+
+    return false;
+}
+
+void CommandFloodLimiter::Reset(int slot)
+{
+    if (slot < 0 || slot >= kMaxSlots) return;
+
+    m_buckets[slot] = Bucket();
+}
+
+bool CommandFloodLimiter::IsLimited(int slot) const
+{
+    if (m_bypass || slot < 0 || slot >= kMaxSlots) return false;
+
+    return m_buckets[slot].limited;
+}
+
+uint32_t CommandFloodLimiter::GetDroppedCount(int slot) const
+{
+    if (slot < 0 || slot >= kMaxSlots) return 0;
+
+    return m_buckets[slot].dropped;
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,61 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace counterstrikesharp {
+
+/**
+ * Per-slot token bucket used to stop a single client from flooding managed command callbacks.
+ *
+ * Each client command or chat command consumes one token. Tokens refill at `CommandFloodRate` per
+ * second up to `CommandFloodBurst`; commands arriving with an empty bucket are dropped entirely, never
+ * reaching the game or any callback, and counted against the player. Disabled when `CommandFloodRate` is 0.
+ */
+class CommandFloodLimiter
+{
+  public:
+    static constexpr int kMaxSlots = 64;
+
+    bool TryConsume(int slot);
+    void Reset(int slot);
+
+    /** Whether the most recent command from this slot was dropped. */
+    bool IsLimited(int slot) const;
+
+    uint32_t GetDroppedCount(int slot) const;
+    uint64_t GetTotalDroppedCount() const { return m_totalDropped; }
+
+    /** Commands dispatched by the server on behalf of a client are not rate limited. */
+    void SetBypass(bool bypass) { m_bypass = bypass; }
+
+  private:
+    struct Bucket
+    {
+        double lastRefill = 0.0;
+        float tokens = -1.0f;
+        uint32_t dropped = 0;
+        bool limited = false;
+    };
+
+    Bucket m_buckets[kMaxSlots];
+    uint64_t m_totalDropped = 0;
+    bool m_bypass = false;
+};
+
+} // namespace counterstrikesharp
@@ -60,6 +60,16 @@ bool CCoreConfig::Init(char* conf_error, int conf_error_size)
         ServerLanguage = m_json.value("ServerLanguage", ServerLanguage);
         UnlockConCommands = m_json.value("UnlockConCommands", UnlockConCommands);
         UnlockConVars = m_json.value("UnlockConVars", UnlockConVars);
+        AuthCheckInterval = m_json.value("AuthCheckInterval", AuthCheckInterval);
+        CommandFloodRate = m_json.value("CommandFloodRate", CommandFloodRate);
+        CommandFloodBurst = m_json.value("CommandFloodBurst", CommandFloodBurst);
+        AsyncLogging = m_json.value("AsyncLogging", AsyncLogging);
+        AsyncLoggingQueueSize = m_json.value("AsyncLoggingQueueSize", AsyncLoggingQueueSize);
+        AsyncLoggingDropWhenFull = m_json.value("AsyncLoggingDropWhenFull", AsyncLoggingDropWhenFull);
+        TraceCategories = m_json.value("TraceCategories", TraceCategories);
+        TaskFrameBudget = m_json.value("TaskFrameBudget", TaskFrameBudget);
+        JobThreadCount = m_json.value("JobThreadCount", JobThreadCount);
+        JobAvoidGameThreadCores = m_json.value("JobAvoidGameThreadCores", JobAvoidGameThreadCores);
     }
     catch (const std::exception& ex)
     {
@@ -67,33 +77,27 @@ bool CCoreConfig::Init(char* conf_error, int conf_error_size)
         return false;
     }
 
+    m_publicTriggers.Compile(PublicChatTrigger);
+    m_silentTriggers.Compile(SilentChatTrigger);
+
     return true;
 }
 
 const std::string CCoreConfig::GetPath() const { return m_sPath; }
 
-bool CCoreConfig::IsTriggerInternal(std::vector<std::string> triggers, const std::string& message, std::string& prefix) const
+bool CCoreConfig::IsSilentChatTrigger(std::string_view message, std::string_view& prefix) const
 {
-    for (std::string& trigger : triggers)
-    {
-        if (message.rfind(trigger, 0) == 0)
-        {
-            prefix = trigger;
-            CSSHARP_CORE_TRACE("Trigger found, prefix is {}", prefix);
-            return true;
-        }
-    }
+    if (!m_silentTriggers.Match(message, prefix)) return false;
 
-    return false;
+    CSSHARP_CORE_TRACE("Trigger found, prefix is {}", prefix);
+    return true;
 }
 
-bool CCoreConfig::IsSilentChatTrigger(const std::string& message, std::string& prefix) const
+bool CCoreConfig::IsPublicChatTrigger(std::string_view message, std::string_view& prefix) const
 {
-    return IsTriggerInternal(SilentChatTrigger, message, prefix);
-}
+    if (!m_publicTriggers.Match(message, prefix)) return false;
 
-bool CCoreConfig::IsPublicChatTrigger(const std::string& message, std::string& prefix) const
-{
-    return IsTriggerInternal(PublicChatTrigger, message, prefix);
+    CSSHARP_CORE_TRACE("Trigger found, prefix is {}", prefix);
+    return true;
 }
 } // namespace counterstrikesharp
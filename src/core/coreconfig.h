@@ -19,7 +19,9 @@
 #include <nlohmann/json.hpp>
 
 #include <string>
+#include <string_view>
 
+#include "core/chat_trigger_matcher.h"
 #include "core/globals.h"
 
 namespace counterstrikesharp {
@@ -35,6 +37,16 @@ class CCoreConfig
     std::string ServerLanguage = "en";
     bool UnlockConCommands = true;
     bool UnlockConVars = true;
+    float AuthCheckInterval = 0.1f;
+    float CommandFloodRate = 0.0f;
+    int CommandFloodBurst = 32;
+    bool AsyncLogging = false;
+    int AsyncLoggingQueueSize = 8192;
+    bool AsyncLoggingDropWhenFull = false;
+    std::vector<std::string> TraceCategories = {};
+    int TaskFrameBudget = 0;
+    int JobThreadCount = 0;
+    bool JobAvoidGameThreadCores = true;
 
     using json = nlohmann::json;
     CCoreConfig(const std::string& path);
@@ -43,15 +55,14 @@ class CCoreConfig
     bool Init(char* conf_error, int conf_error_size);
     const std::string GetPath() const;
 
-    bool IsSilentChatTrigger(const std::string& message, std::string& prefix) const;
-    bool IsPublicChatTrigger(const std::string& message, std::string& prefix) const;
-
-  private:
-    bool IsTriggerInternal(std::vector<std::string> triggers, const std::string& message, std::string& prefix) const;
+    bool IsSilentChatTrigger(std::string_view message, std::string_view& prefix) const;
+    bool IsPublicChatTrigger(std::string_view message, std::string_view& prefix) const;
 
   private:
     std::string m_sPath;
     json m_json;
+    ChatTriggerMatcher m_publicTriggers;
+    ChatTriggerMatcher m_silentTriggers;
 };
 
 } // namespace counterstrikesharp
@@ -0,0 +1,171 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/entity_data_store.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace counterstrikesharp {
+
+namespace {
+constexpr uint32_t kInvalidRef = 0xFFFFFFFF;
+constexpr uint32_t kIndexMask = 0x7FFF;
+} // namespace
+
+EntityDataStore::Slot::~Slot()
+{
+    for (auto* pChunk : chunks)
+    {
+        delete[] pChunk;
+    }
+}
+
+int EntityDataStore::AllocateSlot(int nSize, const char* szOwner)
+{
+    if (nSize <= 0) return kInvalidSlot;
+
+    auto it = std::find_if(m_slots.begin(), m_slots.end(), [](const std::unique_ptr<Slot>& slot) { return !slot->bInUse; });
+    if (it == m_slots.end())
+    {
+        m_slots.push_back(std::make_unique<Slot>());
+        it = m_slots.end() - 1;
+    }
+
+    auto& slot = **it;
+    slot.bInUse = true;
+    // Keep every entry 8-byte aligned so plugins can store doubles/pointers without unaligned access.
+    slot.nStride = (static_cast<size_t>(nSize) + 7) & ~static_cast<size_t>(7);
+    slot.owner = szOwner ? szOwner : "";
+
+    return static_cast<int>(it - m_slots.begin());
+}
+
+bool EntityDataStore::IsValidSlot(int iSlot) const
+{
+    return iSlot >= 0 && iSlot < static_cast<int>(m_slots.size()) && m_slots[iSlot]->bInUse;
+}
+
+bool EntityDataStore::FreeSlot(int iSlot)
+{
+    if (!IsValidSlot(iSlot)) return false;
+
+    // Reset in place rather than erase so that other slot ids stay stable.
+    m_slots[iSlot] = std::make_unique<Slot>();
+    return true;
+}
+
+uint8_t* EntityDataStore::GetChunk(Slot& slot, uint32_t nIndex, bool bCreate)
+{
+    auto& pChunk = slot.chunks[nIndex / kEntriesPerChunk];
+    if (pChunk || !bCreate) return pChunk;
+
+    pChunk = new uint8_t[kChunkHeaderSize + slot.nStride * kEntriesPerChunk]();
+    std::fill(ChunkRefs(pChunk), ChunkRefs(pChunk) + kEntriesPerChunk, kInvalidRef);
+    slot.nAllocatedChunks++;
+
+    return pChunk;
+}
+
+uint8_t* const* EntityDataStore::GetChunkTable(int iSlot) const
+{
+    if (!IsValidSlot(iSlot)) return nullptr;
+
+    return m_slots[iSlot]->chunks;
+}
+
+void EntityDataStore::ResetEntry(Slot& slot, uint32_t nIndex)
+{
+    auto pChunk = GetChunk(slot, nIndex, false);
+    if (!pChunk) return;
+
+    auto nEntry = nIndex % kEntriesPerChunk;
+    ChunkRefs(pChunk)[nEntry] = kInvalidRef;
+    memset(ChunkEntry(slot, pChunk, nEntry), 0, slot.nStride);
+}
+
+void* EntityDataStore::Get(int iSlot, uint32_t nEntityRef, bool bCreate)
+{
+    if (!IsValidSlot(iSlot) || nEntityRef == kInvalidRef) return nullptr;
+
+    auto& slot = *m_slots[iSlot];
+    auto nIndex = nEntityRef & kIndexMask;
+
+    auto pChunk = GetChunk(slot, nIndex, bCreate);
+    if (!pChunk) return nullptr;
+
+    auto nEntry = nIndex % kEntriesPerChunk;
+    auto pData = ChunkEntry(slot, pChunk, nEntry);
+
+    if (ChunkRefs(pChunk)[nEntry] != nEntityRef)
+    {
+        if (!bCreate) return nullptr;
+
+        // Either empty or left over from an older entity at this index; start from zeroed storage.
+        memset(pData, 0, slot.nStride);
+        ChunkRefs(pChunk)[nEntry] = nEntityRef;
+    }
+
+    return pData;
+}
+
+void EntityDataStore::Clear(int iSlot, uint32_t nEntityRef)
+{
+    if (!IsValidSlot(iSlot) || nEntityRef == kInvalidRef) return;
+
+    auto& slot = *m_slots[iSlot];
+    auto nIndex = nEntityRef & kIndexMask;
+
+    auto pChunk = GetChunk(slot, nIndex, false);
+    if (!pChunk || ChunkRefs(pChunk)[nIndex % kEntriesPerChunk] != nEntityRef) return;
+
+    ResetEntry(slot, nIndex);
+}
+
+void EntityDataStore::OnEntityDeleted(uint32_t nEntityRef)
+{
+    if (nEntityRef == kInvalidRef) return;
+
+    auto nIndex = nEntityRef & kIndexMask;
+
+    for (auto& pSlot : m_slots)
+    {
+        if (!pSlot->bInUse) continue;
+
+        auto pChunk = GetChunk(*pSlot, nIndex, false);
+        if (pChunk && ChunkRefs(pChunk)[nIndex % kEntriesPerChunk] != kInvalidRef)
+        {
+            ResetEntry(*pSlot, nIndex);
+        }
+    }
+}
+
+size_t EntityDataStore::GetMemoryUsage(const char* szOwner) const
+{
+    size_t nTotal = 0;
+
+    for (auto& pSlot : m_slots)
+    {
+        if (!pSlot->bInUse) continue;
+        if (szOwner && szOwner[0] && pSlot->owner != szOwner) continue;
+
+        nTotal += pSlot->nAllocatedChunks * (kChunkHeaderSize + pSlot->nStride * kEntriesPerChunk);
+    }
+
+    return nTotal;
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,90 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace counterstrikesharp {
+
+/**
+ * Fixed-size per-entity storage that plugins can allocate "slots" in.
+ *
+ * Each slot holds one blob of the slot's size per entity index, stored in lazily allocated chunks
+ * of 512 entities (mirroring the entity identity chunks). Every entry remembers the entity handle it
+ * was written for, so a stale handle never observes data that belongs to a newer entity re-using the
+ * same index. Entries are zeroed when their entity is deleted.
+ *
+ * Managed code reads entries without a native call, using the slot's chunk table (see GetChunkTable). Each chunk is one
+ * block: kEntriesPerChunk entity refs (uint32), followed at kChunkHeaderSize by kEntriesPerChunk entries of the slot's
+ * stride (the size rounded up to 8 bytes).
+ */
+class EntityDataStore
+{
+  public:
+    static constexpr int kInvalidSlot = -1;
+    static constexpr uint32_t kEntriesPerChunk = 512;
+    static constexpr size_t kChunkHeaderSize = kEntriesPerChunk * sizeof(uint32_t);
+
+    int AllocateSlot(int nSize, const char* szOwner);
+    bool FreeSlot(int iSlot);
+    bool IsValidSlot(int iSlot) const;
+
+    void* Get(int iSlot, uint32_t nEntityRef, bool bCreate);
+    void Clear(int iSlot, uint32_t nEntityRef);
+    // Table of the slot's chunks, null where no chunk has been allocated yet. Stays valid until the slot is freed.
+    uint8_t* const* GetChunkTable(int iSlot) const;
+
+    void OnEntityDeleted(uint32_t nEntityRef);
+
+    size_t GetMemoryUsage(const char* szOwner) const;
+
+  private:
+    static constexpr uint32_t kMaxEntities = 32768;
+    static constexpr uint32_t kChunkCount = kMaxEntities / kEntriesPerChunk;
+
+    struct Slot
+    {
+        Slot() = default;
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        ~Slot();
+
+        bool bInUse = false;
+        size_t nStride = 0;
+        std::string owner;
+        // Raw pointers so managed code can index the table directly.
+        uint8_t* chunks[kChunkCount] = {};
+        uint32_t nAllocatedChunks = 0;
+    };
+
+    static uint32_t* ChunkRefs(uint8_t* pChunk) { return reinterpret_cast<uint32_t*>(pChunk); }
+    static uint8_t* ChunkEntry(const Slot& slot, uint8_t* pChunk, uint32_t nEntry)
+    {
+        return pChunk + kChunkHeaderSize + nEntry * slot.nStride;
+    }
+
+    uint8_t* GetChunk(Slot& slot, uint32_t nIndex, bool bCreate);
+    void ResetEntry(Slot& slot, uint32_t nIndex);
+
+    std::vector<std::unique_ptr<Slot>> m_slots;
+};
+
+} // namespace counterstrikesharp
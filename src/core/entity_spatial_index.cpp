@@ -0,0 +1,334 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/entity_spatial_index.h"
+
+#include <entity2/entitysystem.h>
+#include <schema.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "core/globals.h"
+
+namespace counterstrikesharp {
+
+namespace {
+// 21 bits per axis covers +/- 2^20 cells, far beyond the playable area for any sane cell size.
+constexpr int kCellBits = 21;
+constexpr int kCellBias = 1 << (kCellBits - 1);
+constexpr uint64_t kCellMask = (1ull << kCellBits) - 1;
+
+bool ReadAbsOrigin(CEntityInstance* pEntity, Vector& vecOrigin)
+{
+    static auto baseEntityKey = hash_32_fnv1a_const("CBaseEntity");
+    static auto bodyComponentKey = hash_32_fnv1a_const("m_CBodyComponent");
+    static auto bodyComponentClassKey = hash_32_fnv1a_const("CBodyComponent");
+    static auto sceneNodeKey = hash_32_fnv1a_const("m_pSceneNode");
+    static auto sceneNodeClassKey = hash_32_fnv1a_const("CGameSceneNode");
+    static auto absOriginKey = hash_32_fnv1a_const("m_vecAbsOrigin");
+
+    const static auto m_bodyComponent = schema::GetOffset("CBaseEntity", baseEntityKey, "m_CBodyComponent", bodyComponentKey);
+    const static auto m_sceneNode = schema::GetOffset("CBodyComponent", bodyComponentClassKey, "m_pSceneNode", sceneNodeKey);
+    const static auto m_absOrigin = schema::GetOffset("CGameSceneNode", sceneNodeClassKey, "m_vecAbsOrigin", absOriginKey);
+
+    auto pBodyComponent = *reinterpret_cast<uintptr_t*>((uintptr_t)(pEntity) + m_bodyComponent.offset);
+    if (!pBodyComponent) return false;
+
+    auto pSceneNode = *reinterpret_cast<uintptr_t*>(pBodyComponent + m_sceneNode.offset);
+    if (!pSceneNode) return false;
+
+    vecOrigin = *reinterpret_cast<Vector*>(pSceneNode + m_absOrigin.offset);
+    return true;
+}
+
+bool MatchesClassname(CEntityInstance* pEntity, const char* szClassname)
+{
+    if (!szClassname || !szClassname[0]) return true;
+
+    auto szEntityClassname = pEntity->GetClassname();
+    return szEntityClassname && strcmp(szEntityClassname, szClassname) == 0;
+}
+} // namespace
+
+EntitySpatialIndex::EntitySpatialIndex(float flCellSize) : m_flCellSize(flCellSize), m_flInvCellSize(1.0f / flCellSize) {}
+
+int EntitySpatialIndex::CellCoord(float flValue) const
+{
+    auto iCoord = static_cast<int>(std::floor(flValue * m_flInvCellSize));
+    return std::clamp(iCoord, -kCellBias, kCellBias - 1);
+}
+
+uint64_t EntitySpatialIndex::CellKey(const Vector& vecOrigin) const
+{
+    auto x = static_cast<uint64_t>(CellCoord(vecOrigin.x) + kCellBias) & kCellMask;
+    auto y = static_cast<uint64_t>(CellCoord(vecOrigin.y) + kCellBias) & kCellMask;
+    auto z = static_cast<uint64_t>(CellCoord(vecOrigin.z) + kCellBias) & kCellMask;
+    return (x << (kCellBits * 2)) | (y << kCellBits) | z;
+}
+
+void EntitySpatialIndex::OnEntitySpawned(CEntityInstance* pEntity)
+{
+    // Until the first query we have nothing to keep in sync; Populate() picks everything up at once.
+    if (!m_bPopulated) return;
+
+    Insert(pEntity);
+}
+
+void EntitySpatialIndex::OnEntityDeleted(CEntityInstance* pEntity)
+{
+    if (!m_bPopulated) return;
+
+    Remove(pEntity->GetEntityIndex().Get());
+}
+
+void EntitySpatialIndex::Clear()
+{
+    m_vecEntries.clear();
+    m_vecTracked.clear();
+    m_mapCells.clear();
+    m_bPopulated = false;
+    m_iLastRefreshTick = -1;
+}
+
+void EntitySpatialIndex::Populate()
+{
+    Clear();
+
+    if (!globals::entitySystem) return;
+
+    for (auto pIdentity = globals::entitySystem->m_EntityList.m_pFirstActiveEntity; pIdentity; pIdentity = pIdentity->m_pNext)
+    {
+        if (pIdentity->m_pInstance) Insert(pIdentity->m_pInstance);
+    }
+
+    m_bPopulated = true;
+}
+
+void EntitySpatialIndex::Insert(CEntityInstance* pEntity)
+{
+    auto nIndex = static_cast<uint32_t>(pEntity->GetEntityIndex().Get());
+
+    Vector vecOrigin;
+    if (!ReadAbsOrigin(pEntity, vecOrigin)) return;
+
+    if (nIndex >= m_vecEntries.size()) m_vecEntries.resize(nIndex + 1);
+
+    auto& entry = m_vecEntries[nIndex];
+    if (entry.pEntity) Remove(nIndex);
+
+    entry.pEntity = pEntity;
+    entry.vecOrigin = vecOrigin;
+    entry.nTrackedSlot = static_cast<int>(m_vecTracked.size());
+    m_vecTracked.push_back(nIndex);
+
+    LinkCell(nIndex, CellKey(vecOrigin));
+}
+
+void EntitySpatialIndex::Remove(uint32_t nIndex)
+{
+    if (nIndex >= m_vecEntries.size() || !m_vecEntries[nIndex].pEntity) return;
+
+    auto& entry = m_vecEntries[nIndex];
+    UnlinkCell(nIndex);
+
+    auto nLast = m_vecTracked.back();
+    m_vecTracked[entry.nTrackedSlot] = nLast;
+    m_vecEntries[nLast].nTrackedSlot = entry.nTrackedSlot;
+    m_vecTracked.pop_back();
+
+    entry = Entry();
+}
+
+void EntitySpatialIndex::LinkCell(uint32_t nIndex, uint64_t nCell)
+{
+    auto& cell = m_mapCells[nCell];
+    auto& entry = m_vecEntries[nIndex];
+
+    entry.nCell = nCell;
+    entry.nCellSlot = static_cast<int>(cell.size());
+    cell.push_back(nIndex);
+}
+
+void EntitySpatialIndex::UnlinkCell(uint32_t nIndex)
+{
+    auto& entry = m_vecEntries[nIndex];
+    auto search = m_mapCells.find(entry.nCell);
+    if (search == m_mapCells.end()) return;
+
+    auto& cell = search->second;
+    auto nLast = cell.back();
+    cell[entry.nCellSlot] = nLast;
+    m_vecEntries[nLast].nCellSlot = entry.nCellSlot;
+    cell.pop_back();
+
+    if (cell.empty()) m_mapCells.erase(search);
+
+    entry.nCellSlot = -1;
+}
+
+void EntitySpatialIndex::Refresh()
+{
+    if (!m_bPopulated) Populate();
+
+    auto pGlobalVars = globals::getGlobalVars();
+    auto iTick = pGlobalVars ? pGlobalVars->tickcount : -1;
+
+    if (iTick != -1 && iTick == m_iLastRefreshTick) return;
+    m_iLastRefreshTick = iTick;
+
+    for (auto nIndex : m_vecTracked)
+    {
+        auto& entry = m_vecEntries[nIndex];
+        if (!ReadAbsOrigin(entry.pEntity, entry.vecOrigin)) continue;
+
+        auto nCell = CellKey(entry.vecOrigin);
+        if (nCell == entry.nCell) continue;
+
+        UnlinkCell(nIndex);
+        LinkCell(nIndex, nCell);
+    }
+}
+
+template <typename Fn> void EntitySpatialIndex::ForEachCandidate(const Vector& vecMins, const Vector& vecMaxs, Fn&& fn)
+{
+    int minX = CellCoord(vecMins.x), maxX = CellCoord(vecMaxs.x);
+    int minY = CellCoord(vecMins.y), maxY = CellCoord(vecMaxs.y);
+    int minZ = CellCoord(vecMins.z), maxZ = CellCoord(vecMaxs.z);
+
+    auto nCellsInRange = uint64_t(maxX - minX + 1) * uint64_t(maxY - minY + 1) * uint64_t(maxZ - minZ + 1);
+
+    // Very large query volumes touch more cells than are actually occupied, at which point walking the occupied
+    // cells is cheaper than probing every coordinate in range. Callers do the exact bounds test either way.
+    if (nCellsInRange > m_mapCells.size())
+    {
+        for (auto& [nCell, cell] : m_mapCells)
+        {
+            for (auto nIndex : cell)
+            {
+                if (!fn(nIndex)) return;
+            }
+        }
+        return;
+    }
+
+    for (int x = minX; x <= maxX; x++)
+    {
+        for (int y = minY; y <= maxY; y++)
+        {
+            for (int z = minZ; z <= maxZ; z++)
+            {
+                auto nCell = (uint64_t(x + kCellBias) << (kCellBits * 2)) | (uint64_t(y + kCellBias) << kCellBits) | uint64_t(z + kCellBias);
+
+                auto search = m_mapCells.find(nCell);
+                if (search == m_mapCells.end()) continue;
+
+                for (auto nIndex : search->second)
+                {
+                    if (!fn(nIndex)) return;
+                }
+            }
+        }
+    }
+}
+
+int EntitySpatialIndex::QuerySphere(const Vector& vecCenter, float flRadius, const char* szClassname, uint32_t* pResults, int nMaxResults)
+{
+    if (nMaxResults <= 0 || flRadius < 0.0f) return 0;
+
+    Refresh();
+
+    Vector vecExtent(flRadius, flRadius, flRadius);
+    auto flRadiusSqr = flRadius * flRadius;
+    int nCount = 0;
+
+    ForEachCandidate(vecCenter - vecExtent, vecCenter + vecExtent, [&](uint32_t nIndex) {
+        auto& entry = m_vecEntries[nIndex];
+        if (entry.vecOrigin.DistToSqr(vecCenter) > flRadiusSqr) return true;
+        if (!MatchesClassname(entry.pEntity, szClassname)) return true;
+
+        pResults[nCount++] = nIndex;
+        return nCount < nMaxResults;
+    });
+
+    return nCount;
+}
+
+int EntitySpatialIndex::QueryBox(const Vector& vecMins, const Vector& vecMaxs, const char* szClassname, uint32_t* pResults, int nMaxResults)
+{
+    if (nMaxResults <= 0) return 0;
+
+    Refresh();
+
+    int nCount = 0;
+
+    ForEachCandidate(vecMins, vecMaxs, [&](uint32_t nIndex) {
+        auto& entry = m_vecEntries[nIndex];
+        const auto& vecOrigin = entry.vecOrigin;
+
+        if (vecOrigin.x < vecMins.x || vecOrigin.y < vecMins.y || vecOrigin.z < vecMins.z) return true;
+        if (vecOrigin.x > vecMaxs.x || vecOrigin.y > vecMaxs.y || vecOrigin.z > vecMaxs.z) return true;
+        if (!MatchesClassname(entry.pEntity, szClassname)) return true;
+
+        pResults[nCount++] = nIndex;
+        return nCount < nMaxResults;
+    });
+
+    return nCount;
+}
+
+int EntitySpatialIndex::QueryNearest(const Vector& vecCenter, float flMaxDistance, const char* szClassname, uint32_t* pResults, int nMaxResults)
+{
+    if (nMaxResults <= 0) return 0;
+
+    Refresh();
+
+    m_vecNearestScratch.clear();
+
+    auto collect = [&](uint32_t nIndex) {
+        auto& entry = m_vecEntries[nIndex];
+        auto flDistSqr = entry.vecOrigin.DistToSqr(vecCenter);
+
+        if (flMaxDistance > 0.0f && flDistSqr > flMaxDistance * flMaxDistance) return true;
+        if (!MatchesClassname(entry.pEntity, szClassname)) return true;
+
+        m_vecNearestScratch.emplace_back(flDistSqr, nIndex);
+        return true;
+    };
+
+    // A non-positive distance means "anywhere on the map".
+    if (flMaxDistance > 0.0f)
+    {
+        Vector vecExtent(flMaxDistance, flMaxDistance, flMaxDistance);
+        ForEachCandidate(vecCenter - vecExtent, vecCenter + vecExtent, collect);
+    }
+    else
+    {
+        for (auto nIndex : m_vecTracked)
+            collect(nIndex);
+    }
+
+    auto nCount = std::min<size_t>(m_vecNearestScratch.size(), nMaxResults);
+    std::partial_sort(m_vecNearestScratch.begin(), m_vecNearestScratch.begin() + nCount, m_vecNearestScratch.end());
+
+    for (size_t i = 0; i < nCount; i++)
+        pResults[i] = m_vecNearestScratch[i].second;
+
+    return static_cast<int>(nCount);
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,84 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mathlib/vector.h"
+
+class CEntityInstance;
+
+namespace counterstrikesharp {
+
+/**
+ * Uniform grid over entity absolute origins, used to answer radius, box and
+ * nearest-N queries without walking the whole entity list from managed code.
+ *
+ * Entities are added as they spawn and removed as they are deleted. Origins are
+ * re-read lazily, at most once per server tick, the first time a query runs in
+ * that tick; only entities that crossed a cell boundary are moved.
+ */
+class EntitySpatialIndex
+{
+  public:
+    explicit EntitySpatialIndex(float flCellSize = 256.0f);
+
+    void OnEntitySpawned(CEntityInstance* pEntity);
+    void OnEntityDeleted(CEntityInstance* pEntity);
+    void Clear();
+
+    int QuerySphere(const Vector& vecCenter, float flRadius, const char* szClassname, uint32_t* pResults, int nMaxResults);
+    int QueryBox(const Vector& vecMins, const Vector& vecMaxs, const char* szClassname, uint32_t* pResults, int nMaxResults);
+    int QueryNearest(const Vector& vecCenter, float flMaxDistance, const char* szClassname, uint32_t* pResults, int nMaxResults);
+
+  private:
+    struct Entry
+    {
+        CEntityInstance* pEntity = nullptr;
+        Vector vecOrigin;
+        uint64_t nCell = 0;
+        int nCellSlot = -1;
+        int nTrackedSlot = -1;
+    };
+
+    void Populate();
+    void Refresh();
+    void Insert(CEntityInstance* pEntity);
+    void Remove(uint32_t nIndex);
+    void LinkCell(uint32_t nIndex, uint64_t nCell);
+    void UnlinkCell(uint32_t nIndex);
+
+    uint64_t CellKey(const Vector& vecOrigin) const;
+    int CellCoord(float flValue) const;
+
+    template <typename Fn> void ForEachCandidate(const Vector& vecMins, const Vector& vecMaxs, Fn&& fn);
+
+    float m_flCellSize;
+    float m_flInvCellSize;
+    bool m_bPopulated = false;
+    int m_iLastRefreshTick = -1;
+
+    std::vector<Entry> m_vecEntries;
+    std::vector<uint32_t> m_vecTracked;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_mapCells;
+    std::vector<std::pair<float, uint32_t>> m_vecNearestScratch;
+};
+
+} // namespace counterstrikesharp
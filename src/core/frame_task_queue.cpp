@@ -0,0 +1,102 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/frame_task_queue.h"
+
+#include <algorithm>
+
+namespace counterstrikesharp {
+
+void FrameTaskQueue::Enqueue(std::function<void()>&& task, TaskPriority priority)
+{
+    m_incoming[static_cast<int>(priority)].enqueue(std::move(task));
+}
+
+void FrameTaskQueue::EnqueueLocal(std::function<void()>&& task, TaskPriority priority)
+{
+    m_pending[static_cast<int>(priority)].push_back(std::move(task));
+}
+
+void FrameTaskQueue::Drain()
+{
+    for (std::size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        auto& incoming = m_incoming[priority];
+        if (incoming.size_approx() == 0) continue;
+
+        const auto count = incoming.try_dequeue_bulk(m_drainBuffer.begin(), m_drainBuffer.size());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_pending[priority].push_back(std::move(m_drainBuffer[i]));
+            m_drainBuffer[i] = nullptr;
+        }
+    }
+}
+
+std::size_t FrameTaskQueue::Run(std::chrono::microseconds budget)
+{
+    // Tasks queued while running wait for the next frame, as they did before budgets existed.
+    std::size_t counts[kPriorityCount];
+    std::size_t total = 0;
+    for (std::size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        counts[priority] = m_pending[priority].size();
+        total += counts[priority];
+    }
+
+    if (total == 0) return 0;
+
+    m_peakDepth = std::max(m_peakDepth, total);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t ran = 0;
+
+    for (std::size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        auto& pending = m_pending[priority];
+        for (std::size_t i = 0; i < counts[priority]; i++)
+        {
+            // At least one task runs every frame, so a budget smaller than any one task still makes progress.
+            if (priority != static_cast<std::size_t>(TaskPriority::High) && budget.count() > 0 && ran > 0 &&
+                std::chrono::steady_clock::now() - start >= budget)
+            {
+                m_overruns++;
+                m_deferred += total - ran;
+                return ran;
+            }
+
+            auto task = std::move(pending.front());
+            pending.pop_front();
+            task();
+            ran++;
+        }
+    }
+
+    return ran;
+}
+
+std::size_t FrameTaskQueue::GetDepth() const
+{
+    std::size_t depth = 0;
+    for (std::size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        depth += m_pending[priority].size() + m_incoming[priority].size_approx();
+    }
+
+    return depth;
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,74 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <concurrentqueue.h>
+
+namespace counterstrikesharp {
+
+enum class TaskPriority : int
+{
+    High = 0,
+    Normal = 1,
+    Low = 2,
+};
+
+/**
+ * Queue of tasks run once per frame on the game thread, optionally within a time budget.
+ *
+ * Tasks can be queued from any thread. With a budget set, high priority tasks always run, and normal then low priority
+ * tasks run until the budget is spent; whatever is left carries over, in order, to the next frame.
+ */
+class FrameTaskQueue
+{
+  public:
+    static constexpr std::size_t kPriorityCount = 3;
+
+    void Enqueue(std::function<void()>&& task, TaskPriority priority = TaskPriority::Normal);
+    // Game thread only; adds to this frame's tasks directly.
+    void EnqueueLocal(std::function<void()>&& task, TaskPriority priority = TaskPriority::Normal);
+
+    // Moves tasks queued from other threads into this frame's tasks.
+    void Drain();
+    // Runs the tasks that were queued when it was called, returning how many ran. A zero budget means no limit.
+    std::size_t Run(std::chrono::microseconds budget);
+
+    [[nodiscard]] std::size_t GetDepth() const;
+    [[nodiscard]] std::size_t GetPeakDepth() const { return m_peakDepth; }
+    // Frames that ran out of budget with tasks left over, and the total number of tasks carried over.
+    [[nodiscard]] std::uint64_t GetOverrunCount() const { return m_overruns; }
+    [[nodiscard]] std::uint64_t GetDeferredCount() const { return m_deferred; }
+
+  private:
+    moodycamel::ConcurrentQueue<std::function<void()>> m_incoming[kPriorityCount];
+    std::deque<std::function<void()>> m_pending[kPriorityCount];
+    // Reused every frame so that draining m_incoming doesn't allocate.
+    std::vector<std::function<void()>> m_drainBuffer = std::vector<std::function<void()>>(1024);
+
+    std::size_t m_peakDepth = 0;
+    std::uint64_t m_overruns = 0;
+    std::uint64_t m_deferred = 0;
+};
+
+} // namespace counterstrikesharp
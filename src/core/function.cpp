@@ -29,9 +29,15 @@
 
 #include "core/function.h"
 
+#include <cstring>
+#include <type_traits>
+
 #include "core/log.h"
+#include "core/managers/entity_manager.h"
 #include "dyncall/dyncall/dyncall.h"
 
+#include <public/entity2/entitysystem.h>
+
 #include "pch.h"
 #include "dynohook/core.h"
 #include "dynohook/manager.h"
@@ -45,7 +51,11 @@
 namespace counterstrikesharp {
 
 DCCallVM* g_pCallVM = dcNewCallVM(4096);
-std::map<dyno::Hook*, ValveFunction*> g_HookMap;
+// Several ValveFunction instances can wrap the same address and therefore share a detour.
+std::unordered_map<dyno::Hook*, std::vector<ValveFunction*>> g_HookMap;
+// Functions whose callbacks are running, innermost last, so parameter access uses the layout of the function that
+// dispatched the callback rather than whichever one created the shared detour.
+thread_local std::vector<std::pair<dyno::Hook*, ValveFunction*>> g_DispatchingFunctions;
 
 // ============================================================================
 // >> GetDynCallConvention
@@ -85,6 +95,8 @@ ValveFunction::ValveFunction(void* ulAddr, Convention_t callingConvention, std::
     m_eCallingConvention = callingConvention;
 
     m_iCallingConvention = GetDynCallConvention(m_eCallingConvention);
+
+    SelectCallPlan();
 }
 
 ValveFunction::ValveFunction(void* ulAddr, Convention_t callingConvention, DataType_t* args, int argCount, DataType_t returnType)
@@ -96,6 +108,8 @@ ValveFunction::ValveFunction(void* ulAddr, Convention_t callingConvention, DataT
 
     m_eCallingConvention = callingConvention;
     m_iCallingConvention = GetDynCallConvention(m_eCallingConvention);
+
+    SelectCallPlan();
 }
 
 ValveFunction::~ValveFunction() {}
@@ -111,10 +125,255 @@ template <class ReturnType, class Function> ReturnType CallHelper(Function func,
 
 void CallHelperVoid(DCCallVM* vm, void* addr) { dcCallVoid(vm, (void*)addr); }
 
+namespace {
+// Register-passed argument counts of the x64 calling conventions. Passing more arguments than the
+// callee declares is harmless on x64 since the caller owns the stack, which lets one thunk shape
+// cover every signature up to these limits.
+constexpr size_t kMaxIntegerArguments = 6;
+constexpr size_t kMaxFloatArguments = 8;
+
+bool IsIntegerType(DataType_t type)
+{
+    switch (type)
+    {
+        case DATA_TYPE_BOOL:
+        case DATA_TYPE_CHAR:
+        case DATA_TYPE_UCHAR:
+        case DATA_TYPE_SHORT:
+        case DATA_TYPE_USHORT:
+        case DATA_TYPE_INT:
+        case DATA_TYPE_UINT:
+        case DATA_TYPE_LONG:
+        case DATA_TYPE_ULONG:
+        case DATA_TYPE_LONG_LONG:
+        case DATA_TYPE_ULONG_LONG:
+        case DATA_TYPE_POINTER:
+        case DATA_TYPE_STRING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsFloatType(DataType_t type) { return type == DATA_TYPE_FLOAT || type == DATA_TYPE_DOUBLE; }
+
+template <class T> uint64_t Widen(T value)
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+    else
+    {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+uint64_t GetIntegerArgument(ScriptContext& script_context, DataType_t type, int index)
+{
+    switch (type)
+    {
+        case DATA_TYPE_BOOL:
+            return script_context.GetArgument<bool>(index) ? 1 : 0;
+        case DATA_TYPE_CHAR:
+            return Widen(script_context.GetArgument<char>(index));
+        case DATA_TYPE_UCHAR:
+            return Widen(script_context.GetArgument<unsigned char>(index));
+        case DATA_TYPE_SHORT:
+            return Widen(script_context.GetArgument<short>(index));
+        case DATA_TYPE_USHORT:
+            return Widen(script_context.GetArgument<unsigned short>(index));
+        case DATA_TYPE_INT:
+            return Widen(script_context.GetArgument<int>(index));
+        case DATA_TYPE_UINT:
+            return Widen(script_context.GetArgument<unsigned int>(index));
+        case DATA_TYPE_LONG:
+            return Widen(script_context.GetArgument<long>(index));
+        case DATA_TYPE_ULONG:
+            return Widen(script_context.GetArgument<unsigned long>(index));
+        case DATA_TYPE_LONG_LONG:
+            return Widen(script_context.GetArgument<long long>(index));
+        case DATA_TYPE_ULONG_LONG:
+            return Widen(script_context.GetArgument<unsigned long long>(index));
+        case DATA_TYPE_POINTER:
+            return reinterpret_cast<uint64_t>(script_context.GetArgument<void*>(index));
+        case DATA_TYPE_STRING:
+            return reinterpret_cast<uint64_t>(script_context.GetArgument<const char*>(index));
+        default:
+            return 0;
+    }
+}
+
+double GetFloatArgument(ScriptContext& script_context, DataType_t type, int index)
+{
+    if (type == DATA_TYPE_DOUBLE)
+    {
+        return script_context.GetArgument<double>(index);
+    }
+
+    // A float parameter only reads the low 32 bits of its XMM register, so place the float's bits there.
+    double packed = 0;
+    float value = script_context.GetArgument<float>(index);
+    memcpy(&packed, &value, sizeof(value));
+    return packed;
+}
+
+using u64 = uint64_t;
+
+template <class R> R InvokeThunk(void* addr, CallPlan plan, const uint64_t (&i)[kMaxIntegerArguments], const double (&f)[kMaxFloatArguments])
+{
+#ifndef _WIN32
+    if (plan == CallPlan::IntegerFloat)
+    {
+        using Thunk = R (*)(u64, u64, u64, u64, u64, u64, double, double, double, double, double, double, double, double);
+        return reinterpret_cast<Thunk>(addr)(i[0], i[1], i[2], i[3], i[4], i[5], f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7]);
+    }
+#endif
+
+    using Thunk = R (*)(u64, u64, u64, u64, u64, u64);
+    return reinterpret_cast<Thunk>(addr)(i[0], i[1], i[2], i[3], i[4], i[5]);
+}
+} // namespace
+
+void ValveFunction::SelectCallPlan()
+{
+    m_callPlan = CallPlan::DynCall;
+
+    if (!IsCallable()) return;
+
+    if (m_eReturnType != DATA_TYPE_VOID && !IsIntegerType(m_eReturnType) && !IsFloatType(m_eReturnType)) return;
+
+    size_t integerCount = 0;
+    size_t floatCount = 0;
+
+    for (auto type : m_Args)
+    {
+        if (IsIntegerType(type))
+        {
+            integerCount++;
+        }
+        else if (IsFloatType(type))
+        {
+            floatCount++;
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    if (integerCount > kMaxIntegerArguments) return;
+
+    if (floatCount == 0)
+    {
+        m_callPlan = CallPlan::Integer;
+        return;
+    }
+
+#ifndef _WIN32
+    // System V assigns integer and float registers independently, so the argument order doesn't matter as
+    // long as everything fits in registers. Windows x64 assigns registers by position; leave it to dyncall.
+    if (floatCount <= kMaxFloatArguments)
+    {
+        m_callPlan = CallPlan::IntegerFloat;
+    }
+#endif
+}
+
+void ValveFunction::CallDirect(ScriptContext& script_context, int offset)
+{
+    uint64_t integerArgs[kMaxIntegerArguments] = {};
+    double floatArgs[kMaxFloatArguments] = {};
+    size_t integerCount = 0;
+    size_t floatCount = 0;
+
+    for (size_t i = 0; i < m_Args.size(); i++)
+    {
+        int contextIndex = i + offset;
+        if (IsFloatType(m_Args[i]))
+        {
+            floatArgs[floatCount++] = GetFloatArgument(script_context, m_Args[i], contextIndex);
+        }
+        else
+        {
+            integerArgs[integerCount++] = GetIntegerArgument(script_context, m_Args[i], contextIndex);
+        }
+    }
+
+    switch (m_eReturnType)
+    {
+        case DATA_TYPE_VOID:
+            InvokeThunk<void>(m_ulAddr, m_callPlan, integerArgs, floatArgs);
+            break;
+        case DATA_TYPE_FLOAT:
+            script_context.SetResult(InvokeThunk<float>(m_ulAddr, m_callPlan, integerArgs, floatArgs));
+            break;
+        case DATA_TYPE_DOUBLE:
+            script_context.SetResult(InvokeThunk<double>(m_ulAddr, m_callPlan, integerArgs, floatArgs));
+            break;
+        default:
+        {
+            // Only the low bits of RAX are defined for narrow return types, truncate to the declared type.
+            auto result = InvokeThunk<uint64_t>(m_ulAddr, m_callPlan, integerArgs, floatArgs);
+            switch (m_eReturnType)
+            {
+                case DATA_TYPE_BOOL:
+                    script_context.SetResult(static_cast<uint8_t>(result) != 0);
+                    break;
+                case DATA_TYPE_CHAR:
+                    script_context.SetResult(static_cast<char>(result));
+                    break;
+                case DATA_TYPE_UCHAR:
+                    script_context.SetResult(static_cast<unsigned char>(result));
+                    break;
+                case DATA_TYPE_SHORT:
+                    script_context.SetResult(static_cast<short>(result));
+                    break;
+                case DATA_TYPE_USHORT:
+                    script_context.SetResult(static_cast<unsigned short>(result));
+                    break;
+                case DATA_TYPE_INT:
+                    script_context.SetResult(static_cast<int>(result));
+                    break;
+                case DATA_TYPE_UINT:
+                    script_context.SetResult(static_cast<unsigned int>(result));
+                    break;
+                case DATA_TYPE_LONG:
+                    script_context.SetResult(static_cast<long>(result));
+                    break;
+                case DATA_TYPE_ULONG:
+                    script_context.SetResult(static_cast<unsigned long>(result));
+                    break;
+                case DATA_TYPE_LONG_LONG:
+                    script_context.SetResult(static_cast<long long>(result));
+                    break;
+                case DATA_TYPE_ULONG_LONG:
+                    script_context.SetResult(static_cast<unsigned long long>(result));
+                    break;
+                case DATA_TYPE_POINTER:
+                    script_context.SetResult(reinterpret_cast<void*>(result));
+                    break;
+                case DATA_TYPE_STRING:
+                    script_context.SetResult(reinterpret_cast<const char*>(result));
+                    break;
+                default:
+                    break;
+            }
+            break;
+        }
+    }
+}
+
 void ValveFunction::Call(ScriptContext& script_context, int offset)
 {
     if (!IsCallable()) return;
 
+    if (m_callPlan != CallPlan::DynCall)
+    {
+        CallDirect(script_context, offset);
+        return;
+    }
+
     dcReset(g_pCallVM);
     dcMode(g_pCallVM, m_iCallingConvention);
 
@@ -230,31 +489,74 @@ void ValveFunction::Call(ScriptContext& script_context, int offset)
     }
 }
 
-dyno::ReturnAction HookHandler(dyno::HookType hookType, dyno::Hook& hook)
+ValveFunction* FindHookedFunction(dyno::Hook* hook)
 {
-    auto vf = g_HookMap[&hook];
+    for (auto dispatching = g_DispatchingFunctions.rbegin(); dispatching != g_DispatchingFunctions.rend(); ++dispatching)
+    {
+        if (dispatching->first == hook) return dispatching->second;
+    }
 
-    auto callback = hookType == dyno::HookType::Pre ? vf->m_precallback : vf->m_postcallback;
+    auto it = g_HookMap.find(hook);
+    if (it == g_HookMap.end() || it->second.empty()) return nullptr;
 
-    if (callback == nullptr)
+    const auto& args = it->second.front()->m_Args;
+    for (auto vf : it->second)
+    {
+        if (vf->m_Args != args) return nullptr;
+    }
+
+    return it->second.front();
+}
+
+dyno::ReturnAction HookHandler(dyno::HookType hookType, dyno::Hook& hook)
+{
+    auto it = g_HookMap.find(&hook);
+    if (it == g_HookMap.end())
     {
         return dyno::ReturnAction::Ignored;
     }
 
-    callback->Reset();
-    callback->ScriptContext().Push(&hook);
+    const bool post = hookType == dyno::HookType::Post;
 
-    for (auto fnMethodToCall : callback->GetFunctions())
+    // A callback can hook another function at this address, which appends to this list and may reallocate it, so walk
+    // it by index and leave out anything added during this call.
+    const auto& functions = it->second;
+    const auto functionCount = functions.size();
+    for (std::size_t i = 0; i < functionCount; i++)
     {
-        if (!fnMethodToCall) continue;
-        fnMethodToCall(&callback->ScriptContextStruct());
+        auto vf = functions[i];
+        auto callback = post ? vf->m_postcallback : vf->m_precallback;
 
-        auto result = callback->ScriptContext().GetResult<HookResult>();
-        CSSHARP_CORE_TRACE("Received hook callback result of {}, hook mode {}", result, (int)hookType);
+        if (callback == nullptr || callback->GetFunctionCount() == 0)
+        {
+            continue;
+        }
+
+        callback->Reset();
+        callback->ScriptContext().Push(&hook);
 
-        if (result >= HookResult::Handled)
+        for (auto fnMethodToCall : callback->GetFunctions())
         {
-            return dyno::ReturnAction::Supercede;
+            if (!fnMethodToCall) continue;
+
+            if (!vf->PassesHookFilters(fnMethodToCall, post, hook))
+            {
+                vf->m_filteredCalls++;
+                continue;
+            }
+
+            vf->m_dispatchedCalls++;
+            g_DispatchingFunctions.emplace_back(&hook, vf);
+            fnMethodToCall(&callback->ScriptContextStruct());
+            g_DispatchingFunctions.pop_back();
+
+            auto result = callback->ScriptContext().GetResult<HookResult>();
+            CSSHARP_CORE_TRACE_CATEGORY(TraceHooks, "Received hook callback result of {}, hook mode {}", result, (int)hookType);
+
+            if (result >= HookResult::Handled)
+            {
+                return dyno::ReturnAction::Supercede;
+            }
         }
     }
 
@@ -276,17 +578,26 @@ std::vector<dyno::DataObject> ConvertArgsToDynoHook(const std::vector<DataType_t
 
 void ValveFunction::AddHook(CallbackT callable, bool post)
 {
-    dyno::HookManager& manager = dyno::HookManager::Get();
-    dyno::Hook* hook = manager.hook((void*)m_ulAddr, [this] {
+    if (m_hook == nullptr)
+    {
+        dyno::HookManager& manager = dyno::HookManager::Get();
+        m_hook = manager.hook((void*)m_ulAddr, [this] {
 #ifdef _WIN32
-        return new dyno::x64MsFastcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
+            return new dyno::x64MsFastcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
 #else
-        return new dyno::x64SystemVcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
+            return new dyno::x64SystemVcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
 #endif
-    });
-    g_HookMap[hook] = this;
-    hook->addCallback(dyno::HookType::Post, (dyno::HookHandler*)&HookHandler);
-    hook->addCallback(dyno::HookType::Pre, (dyno::HookHandler*)&HookHandler);
+        });
+
+        // The handler walks every function sharing this detour, so it only needs registering once per detour.
+        auto& functions = g_HookMap[m_hook];
+        if (functions.empty())
+        {
+            m_hook->addCallback(dyno::HookType::Post, (dyno::HookHandler*)&HookHandler);
+            m_hook->addCallback(dyno::HookType::Pre, (dyno::HookHandler*)&HookHandler);
+        }
+        functions.push_back(this);
+    }
 
     if (post)
     {
@@ -307,15 +618,12 @@ void ValveFunction::AddHook(CallbackT callable, bool post)
 }
 void ValveFunction::RemoveHook(CallbackT callable, bool post)
 {
-    dyno::HookManager& manager = dyno::HookManager::Get();
-    dyno::Hook* hook = manager.hook((void*)m_ulAddr, [this] {
-#ifdef _WIN32
-        return new dyno::x64MsFastcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
-#else
-        return new dyno::x64SystemVcall(ConvertArgsToDynoHook(m_Args), static_cast<dyno::DataType>(this->m_eReturnType));
-#endif
-    });
-    g_HookMap[hook] = this;
+    if (m_hook == nullptr)
+    {
+        return;
+    }
+
+    ClearHookFilters(callable, post);
 
     if (post)
     {
@@ -333,4 +641,148 @@ void ValveFunction::RemoveHook(CallbackT callable, bool post)
     }
 }
 
+namespace {
+template <class T> bool CompareHookParam(HookFilterOp op, T param, T value)
+{
+    switch (op)
+    {
+        case HookFilterOp::Equal:
+            return param == value;
+        case HookFilterOp::NotEqual:
+            return param != value;
+        case HookFilterOp::Less:
+            return param < value;
+        case HookFilterOp::LessOrEqual:
+            return param <= value;
+        case HookFilterOp::Greater:
+            return param > value;
+        case HookFilterOp::GreaterOrEqual:
+            return param >= value;
+        default:
+            return true;
+    }
+}
+
+template <class T> bool CompareSigned(const HookFilterCondition& condition, dyno::Hook& hook)
+{
+    return CompareHookParam<int64_t>(condition.op, hook.getArgument<T>(condition.paramIndex), condition.intValue);
+}
+
+template <class T> bool CompareUnsigned(const HookFilterCondition& condition, dyno::Hook& hook)
+{
+    return CompareHookParam<uint64_t>(condition.op, hook.getArgument<T>(condition.paramIndex), static_cast<uint64_t>(condition.intValue));
+}
+
+bool EvaluateHookFilter(const HookFilterCondition& condition, DataType_t type, dyno::Hook& hook)
+{
+    if (condition.op == HookFilterOp::Classname)
+    {
+        // The parameter is only declared as a pointer, so make sure it is an entity before reading anything from it.
+        auto pointer = hook.getArgument<void*>(condition.paramIndex);
+        if (!globals::entityManager.IsEntityPointer(pointer)) return false;
+
+        auto classname = static_cast<CEntityInstance*>(pointer)->GetClassname();
+        return classname != nullptr && condition.classname == classname;
+    }
+
+    if (condition.op == HookFilterOp::HasFlags)
+    {
+        auto flags = hook.getArgument<uint64_t>(condition.paramIndex);
+        switch (type)
+        {
+            case DATA_TYPE_CHAR:
+            case DATA_TYPE_UCHAR:
+            case DATA_TYPE_BOOL:
+                flags &= 0xFF;
+                break;
+            case DATA_TYPE_SHORT:
+            case DATA_TYPE_USHORT:
+                flags &= 0xFFFF;
+                break;
+            case DATA_TYPE_INT:
+            case DATA_TYPE_UINT:
+                flags &= 0xFFFFFFFF;
+                break;
+            default:
+                break;
+        }
+        return (flags & static_cast<uint64_t>(condition.intValue)) != 0;
+    }
+
+    switch (type)
+    {
+        case DATA_TYPE_BOOL:
+            return CompareUnsigned<bool>(condition, hook);
+        case DATA_TYPE_CHAR:
+            return CompareSigned<char>(condition, hook);
+        case DATA_TYPE_UCHAR:
+            return CompareUnsigned<unsigned char>(condition, hook);
+        case DATA_TYPE_SHORT:
+            return CompareSigned<short>(condition, hook);
+        case DATA_TYPE_USHORT:
+            return CompareUnsigned<unsigned short>(condition, hook);
+        case DATA_TYPE_INT:
+            return CompareSigned<int>(condition, hook);
+        case DATA_TYPE_UINT:
+            return CompareUnsigned<unsigned int>(condition, hook);
+        case DATA_TYPE_LONG:
+            return CompareSigned<long>(condition, hook);
+        case DATA_TYPE_ULONG:
+            return CompareUnsigned<unsigned long>(condition, hook);
+        case DATA_TYPE_LONG_LONG:
+            return CompareSigned<long long>(condition, hook);
+        case DATA_TYPE_ULONG_LONG:
+            return CompareUnsigned<unsigned long long>(condition, hook);
+        case DATA_TYPE_FLOAT:
+            return CompareHookParam<double>(condition.op, hook.getArgument<float>(condition.paramIndex), condition.floatValue);
+        case DATA_TYPE_DOUBLE:
+            return CompareHookParam<double>(condition.op, hook.getArgument<double>(condition.paramIndex), condition.floatValue);
+        case DATA_TYPE_POINTER:
+        case DATA_TYPE_STRING:
+            return CompareHookParam<uint64_t>(condition.op, reinterpret_cast<uintptr_t>(hook.getArgument<void*>(condition.paramIndex)),
+                                              static_cast<uint64_t>(condition.intValue));
+        default:
+            return true;
+    }
+}
+} // namespace
+
+bool ValveFunction::AddHookFilter(CallbackT callable, bool post, HookFilterCondition condition)
+{
+    if (condition.paramIndex < 0 || condition.paramIndex >= static_cast<int>(m_Args.size())) return false;
+
+    auto type = m_Args[condition.paramIndex];
+    if (condition.op == HookFilterOp::Classname && type != DATA_TYPE_POINTER) return false;
+    if (condition.op == HookFilterOp::HasFlags && (type == DATA_TYPE_FLOAT || type == DATA_TYPE_DOUBLE)) return false;
+
+    auto& filters = post ? m_postFilters : m_preFilters;
+    filters[callable].push_back(std::move(condition));
+    return true;
+}
+
+void ValveFunction::ClearHookFilters(CallbackT callable, bool post)
+{
+    auto& filters = post ? m_postFilters : m_preFilters;
+    filters.erase(callable);
+}
+
+bool ValveFunction::PassesHookFilters(CallbackT callable, bool post, dyno::Hook& hook)
+{
+    auto& filters = post ? m_postFilters : m_preFilters;
+    if (filters.empty()) return true;
+
+    auto it = filters.find(callable);
+    if (it == filters.end()) return true;
+
+    for (const auto& condition : it->second)
+    {
+        if (!EvaluateHookFilter(condition, m_Args[condition.paramIndex], hook))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace counterstrikesharp
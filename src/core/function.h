@@ -33,6 +33,8 @@
 #include "scripting/callback_manager.h"
 #include "scripting/script_engine.h"
 #include <map>
+#include <string>
+#include <unordered_map>
 
 namespace dyno {
 class Hook;
@@ -81,6 +83,38 @@ enum Convention_t
     CONV_FASTCALL
 };
 
+enum class HookFilterOp : int
+{
+    Equal,
+    NotEqual,
+    Less,
+    LessOrEqual,
+    Greater,
+    GreaterOrEqual,
+    HasFlags,  // (param & value) != 0
+    Classname, // Pointer param is an entity with the given designer name
+};
+
+// A single condition on a hooked call's parameter. All conditions added for a listener must pass for it to be invoked.
+// Floating point parameters compare against floatValue; integer and pointer parameters compare against intValue, read
+// as unsigned for unsigned types, so 64-bit values and flag masks compare exactly.
+struct HookFilterCondition
+{
+    int paramIndex;
+    HookFilterOp op;
+    double floatValue;
+    int64_t intValue;
+    std::string classname;
+};
+
+// How ValveFunction::Call invokes the target, chosen once when the function is created.
+enum class CallPlan
+{
+    DynCall,      // Generic path, arguments are pushed through dyncall on every call
+    Integer,      // Every argument is passed in an integer register
+    IntegerFloat, // Integer and floating point register arguments (System V only)
+};
+
 class ValveFunction
 {
   public:
@@ -98,6 +132,10 @@ class ValveFunction
     void AddHook(CallbackT callable, bool post);
     void RemoveHook(CallbackT callable, bool post);
 
+    bool AddHookFilter(CallbackT callable, bool post, HookFilterCondition condition);
+    void ClearHookFilters(CallbackT callable, bool post);
+    bool PassesHookFilters(CallbackT callable, bool post, dyno::Hook& hook);
+
     void* m_ulAddr;
     std::vector<DataType_t> m_Args;
     DataType_t m_eReturnType;
@@ -112,6 +150,27 @@ class ValveFunction
     const char* m_signature;
     ScriptCallback* m_precallback = nullptr;
     ScriptCallback* m_postcallback = nullptr;
+
+    CallPlan m_callPlan = CallPlan::DynCall;
+
+    // Detour for m_ulAddr, created the first time a callback is added.
+    dyno::Hook* m_hook = nullptr;
+
+    // Listener invocations skipped by hook filters, and listener invocations that crossed into managed code.
+    uint64_t m_filteredCalls = 0;
+    uint64_t m_dispatchedCalls = 0;
+
+  private:
+    std::unordered_map<CallbackT, std::vector<HookFilterCondition>> m_preFilters;
+    std::unordered_map<CallbackT, std::vector<HookFilterCondition>> m_postFilters;
+
+    void SelectCallPlan();
+    void CallDirect(ScriptContext& args, int offset);
 };
 
+// Returns the function whose callback is currently running for the given detour. Outside a callback, returns the
+// function that owns the detour, or nullptr if functions with different argument layouts share it or the detour
+// wasn't created by a ValveFunction.
+ValveFunction* FindHookedFunction(dyno::Hook* hook);
+
 } // namespace counterstrikesharp
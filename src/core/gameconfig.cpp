@@ -1,7 +1,15 @@
 #include "core/gameconfig.h"
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <optional>
+#include <random>
 
+#include "core/mapped_file.h"
+#include "core/signature_cache.h"
+#include "core/utils.h"
 #include "log.h"
 
 namespace counterstrikesharp {
@@ -10,25 +18,134 @@ CGameConfig::CGameConfig(const std::string& path) { m_sPath = path; }
 
 CGameConfig::~CGameConfig() = default;
 
+namespace {
+// Bump whenever the layout written by SaveCompiled changes.
+constexpr std::uint32_t kCompiledMagic = 0x44475343; // "CSGD"
+constexpr std::uint32_t kCompiledVersion = 1;
+
+#if _WIN32
+constexpr auto kPlatform = "windows";
+#else
+constexpr auto kPlatform = "linux";
+#endif
+
+struct GamedataStamp
+{
+    std::uint64_t size = 0;
+    std::int64_t modified = 0;
+};
+
+std::optional<GamedataStamp> GetGamedataStamp(const std::string& path)
+{
+    std::error_code ec;
+    GamedataStamp stamp;
+    stamp.size = std::filesystem::file_size(path, ec);
+    if (ec) return std::nullopt;
+    stamp.modified = std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+    if (ec) return std::nullopt;
+    return stamp;
+}
+
+class CompiledWriter
+{
+  public:
+    template <typename T> void Write(T value) { m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+    void WriteString(const std::string& value)
+    {
+        Write<std::uint32_t>(value.size());
+        m_buffer.append(value);
+    }
+
+    void WritePattern(const std::vector<int16_t>& pattern)
+    {
+        Write<std::uint32_t>(pattern.size());
+        m_buffer.append(reinterpret_cast<const char*>(pattern.data()), pattern.size() * sizeof(int16_t));
+    }
+
+    const std::string& Buffer() const { return m_buffer; }
+
+  private:
+    std::string m_buffer;
+};
+
+class CompiledReader
+{
+  public:
+    CompiledReader(const std::uint8_t* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T> bool Read(T& value)
+    {
+        if (m_size - m_offset < sizeof(T)) return false;
+        memcpy(&value, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        std::uint32_t length;
+        if (!Read(length) || m_size - m_offset < length) return false;
+        value.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+        m_offset += length;
+        return true;
+    }
+
+    bool ReadPattern(std::vector<int16_t>& pattern)
+    {
+        std::uint32_t length;
+        if (!Read(length) || (m_size - m_offset) / sizeof(int16_t) < length) return false;
+        pattern.resize(length);
+        memcpy(pattern.data(), m_data + m_offset, length * sizeof(int16_t));
+        m_offset += length * sizeof(int16_t);
+        return true;
+    }
+
+  private:
+    const std::uint8_t* m_data;
+    std::size_t m_size;
+    std::size_t m_offset = 0;
+};
+} // namespace
+
 bool CGameConfig::Init(char* conf_error, int conf_error_size)
 {
-    std::ifstream ifs(m_sPath);
-    if (!ifs)
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto stamp = GetGamedataStamp(m_sPath);
+    if (!stamp)
     {
         V_snprintf(conf_error, conf_error_size, "Gamedata file not found.");
         return false;
     }
 
-    m_json = json::parse(ifs);
+    const auto compiledPath = m_sPath + ".bin";
+    const bool fromCompiled = LoadCompiled(compiledPath, stamp->size, stamp->modified);
+    if (!fromCompiled)
+    {
+        if (!LoadJson(conf_error, conf_error_size)) return false;
 
-#if _WIN32
-    constexpr auto platform = "windows";
-#else
-    constexpr auto platform = "linux";
-#endif
+        SaveCompiled(compiledPath, stamp->size, stamp->modified);
+    }
+
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    CSSHARP_CORE_INFO("Loaded gamedata from {} ({:.1f}ms)", fromCompiled ? compiledPath : m_sPath, elapsed);
+    return true;
+}
+
+bool CGameConfig::LoadJson(char* conf_error, int conf_error_size)
+{
+    std::ifstream ifs(m_sPath);
+    if (!ifs)
+    {
+        V_snprintf(conf_error, conf_error_size, "Gamedata file not found.");
+        return false;
+    }
 
     try
     {
+        m_json = json::parse(ifs);
+
         for (auto& [k, v] : m_json.items())
         {
             if (v.contains("signatures"))
@@ -37,21 +154,21 @@ bool CGameConfig::Init(char* conf_error, int conf_error_size)
                 {
                     m_umLibraries[k] = library.get<std::string>();
                 }
-                if (auto signature = v["signatures"][platform]; signature.is_string())
+                if (auto signature = v["signatures"][kPlatform]; signature.is_string())
                 {
                     m_umSignatures[k] = signature.get<std::string>();
                 }
             }
             if (v.contains("offsets"))
             {
-                if (auto offset = v["offsets"][platform]; offset.is_number_integer())
+                if (auto offset = v["offsets"][kPlatform]; offset.is_number_integer())
                 {
                     m_umOffsets[k] = offset.get<std::int64_t>();
                 }
             }
             if (v.contains("patches"))
             {
-                if (auto patch = v["patches"][platform]; patch.is_string())
+                if (auto patch = v["patches"][kPlatform]; patch.is_string())
                 {
                     m_umPatches[k] = patch.get<std::string>();
                 }
@@ -63,9 +180,141 @@ bool CGameConfig::Init(char* conf_error, int conf_error_size)
         V_snprintf(conf_error, conf_error_size, "Failed to parse gamedata file: %s", ex.what());
         return false;
     }
+
+    for (const auto& [name, signature] : m_umSignatures)
+    {
+        if (signature.empty() || signature[0] == '@') continue;
+
+        auto pattern = HexToByte(signature);
+        if (!pattern.empty()) m_umPatterns.emplace(signature, std::move(pattern));
+    }
+
     return true;
 }
 
+bool CGameConfig::LoadCompiled(const std::string& path, std::uint64_t jsonSize, std::int64_t jsonModified)
+{
+    MappedFile file;
+    if (!file.Open(path)) return false;
+
+    CompiledReader reader(file.Data(), file.Size());
+
+    std::uint32_t magic, version, count;
+    GamedataStamp stamp;
+    std::string platform;
+    if (!reader.Read(magic) || magic != kCompiledMagic || !reader.Read(version) || version != kCompiledVersion) return false;
+    if (!reader.Read(stamp.size) || !reader.Read(stamp.modified) || !reader.ReadString(platform)) return false;
+    if (stamp.size != jsonSize || stamp.modified != jsonModified || platform != kPlatform) return false;
+
+    bool ok = reader.Read(count);
+    for (std::uint32_t i = 0; ok && i < count; i++)
+    {
+        std::string name, value;
+        ok = reader.ReadString(name) && reader.ReadString(value);
+        m_umLibraries.emplace(std::move(name), std::move(value));
+    }
+
+    ok = ok && reader.Read(count);
+    for (std::uint32_t i = 0; ok && i < count; i++)
+    {
+        std::string name, signature;
+        std::vector<int16_t> pattern;
+        ok = reader.ReadString(name) && reader.ReadString(signature) && reader.ReadPattern(pattern);
+        if (!pattern.empty()) m_umPatterns.emplace(signature, std::move(pattern));
+        m_umSignatures.emplace(std::move(name), std::move(signature));
+    }
+
+    ok = ok && reader.Read(count);
+    for (std::uint32_t i = 0; ok && i < count; i++)
+    {
+        std::string name;
+        std::int32_t offset;
+        ok = reader.ReadString(name) && reader.Read(offset);
+        m_umOffsets.emplace(std::move(name), offset);
+    }
+
+    ok = ok && reader.Read(count);
+    for (std::uint32_t i = 0; ok && i < count; i++)
+    {
+        std::string name, value;
+        ok = reader.ReadString(name) && reader.ReadString(value);
+        m_umPatches.emplace(std::move(name), std::move(value));
+    }
+
+    if (!ok)
+    {
+        CSSHARP_CORE_WARN("Ignoring truncated compiled gamedata {}", path);
+        m_umLibraries.clear();
+        m_umSignatures.clear();
+        m_umPatterns.clear();
+        m_umOffsets.clear();
+        m_umPatches.clear();
+    }
+
+    return ok;
+}
+
+void CGameConfig::SaveCompiled(const std::string& path, std::uint64_t jsonSize, std::int64_t jsonModified)
+{
+    CompiledWriter writer;
+    writer.Write(kCompiledMagic);
+    writer.Write(kCompiledVersion);
+    writer.Write(jsonSize);
+    writer.Write(jsonModified);
+    writer.WriteString(kPlatform);
+
+    writer.Write<std::uint32_t>(m_umLibraries.size());
+    for (const auto& [name, library] : m_umLibraries)
+    {
+        writer.WriteString(name);
+        writer.WriteString(library);
+    }
+
+    const std::vector<int16_t> noPattern;
+    writer.Write<std::uint32_t>(m_umSignatures.size());
+    for (const auto& [name, signature] : m_umSignatures)
+    {
+        const auto pattern = m_umPatterns.find(signature);
+        writer.WriteString(name);
+        writer.WriteString(signature);
+        writer.WritePattern(pattern != m_umPatterns.end() ? pattern->second : noPattern);
+    }
+
+    writer.Write<std::uint32_t>(m_umOffsets.size());
+    for (const auto& [name, offset] : m_umOffsets)
+    {
+        writer.WriteString(name);
+        writer.Write<std::int32_t>(offset);
+    }
+
+    writer.Write<std::uint32_t>(m_umPatches.size());
+    for (const auto& [name, patch] : m_umPatches)
+    {
+        writer.WriteString(name);
+        writer.WriteString(patch);
+    }
+
+    // Written beside gamedata.json and swapped in, so a concurrent server start never maps a half-written file.
+    const auto tempPath = path + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+        if (!ofs)
+        {
+            CSSHARP_CORE_WARN("Could not write compiled gamedata {}", tempPath);
+            return;
+        }
+        ofs.write(writer.Buffer().data(), writer.Buffer().size());
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec)
+    {
+        CSSHARP_CORE_WARN("Could not write compiled gamedata {}: {}", path, ec.message());
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+
 const std::string CGameConfig::GetPath() { return m_sPath; }
 
 const char* CGameConfig::GetLibrary(const std::string& name)
@@ -89,6 +338,16 @@ const char* CGameConfig::GetSignature(const std::string& name)
     return it->second.c_str();
 }
 
+const std::vector<int16_t>* CGameConfig::GetSignaturePattern(const std::string& signature)
+{
+    auto it = m_umPatterns.find(signature);
+    if (it == m_umPatterns.end())
+    {
+        return nullptr;
+    }
+    return &it->second;
+}
+
 const char* CGameConfig::GetSymbol(const char* name)
 {
     const char* symbol = this->GetSignature(name);
@@ -194,6 +453,60 @@ void* CGameConfig::ResolveSignature(const char* name)
     return address;
 }
 
+void CGameConfig::PreloadSignatures()
+{
+    std::unordered_map<modules::CModule*, std::vector<std::string>> moduleSignatures;
+
+    for (const auto& [name, signature] : m_umSignatures)
+    {
+        if (signature.empty() || signature[0] == '@') continue;
+
+        modules::CModule** module = this->GetModule(name.c_str());
+        if (!module || !(*module)) continue;
+
+        moduleSignatures[*module].push_back(signature);
+    }
+
+    // Kept out of gamedata/, where the managed GameDataProvider parses every *.json file as gamedata.
+    SignatureCache cache(utils::CacheDirectory() + "/signatures.json");
+    cache.Load();
+
+    for (const auto& [module, signatures] : moduleSignatures)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto& moduleId = module->GetModuleId();
+
+        std::vector<std::string> misses;
+        for (const auto& signature : signatures)
+        {
+            const auto rva = cache.Find(moduleId, signature);
+            if (rva && module->IsSignatureAt(module->GetBaseAddress() + *rva, signature.c_str()))
+            {
+                module->SeedSignature(signature, reinterpret_cast<void*>(module->GetBaseAddress() + *rva));
+                continue;
+            }
+
+            misses.push_back(signature);
+        }
+
+        const auto addresses = module->FindSignatures(misses);
+        for (size_t i = 0; i < misses.size(); i++)
+        {
+            if (!addresses[i]) continue;
+
+            cache.Store(moduleId, misses[i], reinterpret_cast<std::uintptr_t>(addresses[i]) - module->GetBaseAddress());
+        }
+
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const auto resolved = std::count_if(addresses.begin(), addresses.end(), [](void* address) { return address != nullptr; });
+        CSSHARP_CORE_INFO("Resolved {}/{} signatures in {} ({} cached, {} scanned, {:.1f}ms)", signatures.size() - misses.size() + resolved,
+                          signatures.size(), module->m_pszModule, signatures.size() - misses.size(), misses.size(), elapsed);
+    }
+
+    cache.Save();
+}
+
 std::string CGameConfig::GetDirectoryName(const std::string& directoryPathInput)
 {
     std::string directoryPath = std::string(directoryPathInput);
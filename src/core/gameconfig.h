@@ -23,6 +23,8 @@ class CGameConfig
     const std::string GetPath();
     const char* GetLibrary(const std::string& name);
     const char* GetSignature(const std::string& name);
+    // Decoded bytes of a gamedata signature (by signature text), or nullptr if it isn't one.
+    const std::vector<int16_t>* GetSignaturePattern(const std::string& signature);
     const char* GetSymbol(const char* name);
     const char* GetPatch(const std::string& name);
     int GetOffset(const std::string& name);
@@ -30,17 +32,25 @@ class CGameConfig
     modules::CModule** GetModule(const char* name);
     bool IsSymbol(const char* name);
     void* ResolveSignature(const char* name);
+    void PreloadSignatures();
 
     static std::string GetDirectoryName(const std::string& directoryPathInput);
     static std::vector<int16_t> HexToByte(std::string_view src);
 
   private:
+    bool LoadJson(char* conf_error, int conf_error_size);
+    // gamedata.json is compiled to a binary file beside it on first load, holding only this platform's entries with
+    // signatures already decoded. It is used while the json's size and modification time are unchanged.
+    bool LoadCompiled(const std::string& path, std::uint64_t jsonSize, std::int64_t jsonModified);
+    void SaveCompiled(const std::string& path, std::uint64_t jsonSize, std::int64_t jsonModified);
+
     std::string m_sPath;
     // use Valve KeyValues in the future.
     // since we'd better make '\' easier.
     json m_json;
     std::unordered_map<std::string, int> m_umOffsets;
     std::unordered_map<std::string, std::string> m_umSignatures;
+    std::unordered_map<std::string, std::vector<int16_t>> m_umPatterns;
     std::unordered_map<std::string, void*> m_umAddresses;
     std::unordered_map<std::string, std::string> m_umLibraries;
     std::unordered_map<std::string, std::string> m_umPatches;
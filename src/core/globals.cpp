@@ -2,6 +2,7 @@
 #include "core/globals.h"
 #include "core/managers/player_manager.h"
 #include "core/tick_scheduler.h"
+#include "core/job_system.h"
 #include "iserver.h"
 #include "managers/event_manager.h"
 #include "scripting/callback_manager.h"
@@ -89,6 +90,7 @@ ChatManager chatManager;
 ServerManager serverManager;
 VoiceManager voiceManager;
 TickScheduler tickScheduler;
+JobSystem jobSystem;
 UserMessageManager userMessageManager;
 
 bool gameLoopInitialized = false;
@@ -111,6 +113,9 @@ void Initialize()
 
     interfaces::Initialize();
 
+    // Resolve every gamedata signature up front, one pass per module, so the lookups below and in managers are cached.
+    globals::gameConfig->PreloadSignatures();
+
     entitySystem = interfaces::pGameResourceServiceServer->GetGameEntitySystem();
 
     GetLegacyGameEventListener = reinterpret_cast<GetLegacyGameEventListener_t*>(
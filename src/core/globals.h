@@ -48,6 +48,7 @@ class ConVarManager;
 class PlayerManager;
 class MenuManager;
 class TickScheduler;
+class JobSystem;
 class TimerSystem;
 class ChatCommands;
 class HookManager;
@@ -106,6 +107,7 @@ extern ChatManager chatManager;
 extern ServerManager serverManager;
 extern VoiceManager voiceManager;
 extern TickScheduler tickScheduler;
+extern JobSystem jobSystem;
 
 extern HookManager hookManager;
 extern SourceHook::ISourceHook* source_hook;
@@ -0,0 +1,287 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+
+#include "core/job_system.h"
+
+#include <algorithm>
+#include <iterator>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "core/globals.h"
+#include "core/log.h"
+#include "mm_plugin.h"
+
+namespace counterstrikesharp {
+
+namespace {
+// Set on worker threads so jobs queued from inside a job go onto that worker's own deque.
+thread_local const JobSystem* t_pool = nullptr;
+thread_local std::size_t t_workerIndex = 0;
+
+std::uint64_t ElapsedMicroseconds(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+}
+} // namespace
+
+JobSystem::~JobSystem() { Stop(); }
+
+void JobSystem::Start(int threadCount, bool avoidGameThreadCores)
+{
+    if (m_running.load()) return;
+
+    // Left over from a previous Stop(); those threads have already been joined.
+    m_workers.clear();
+
+    const auto cores = static_cast<int>(std::thread::hardware_concurrency());
+    // Leave a core for the game thread and one for the engine's own workers.
+    const auto count = static_cast<std::size_t>(threadCount > 0 ? threadCount : std::max(1, cores - 2));
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+
+    m_running = true;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        m_workers[i]->thread = std::thread(&JobSystem::Run, this, i);
+    }
+
+    if (avoidGameThreadCores)
+    {
+        PinWorkers();
+    }
+
+    CSSHARP_CORE_INFO("Started {} job threads", count);
+}
+
+void JobSystem::Stop()
+{
+    if (!m_running.exchange(false)) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_all();
+
+    // m_running is already false, and Submit checks it again under the worker's mutex before pushing, so nothing can be
+    // added to a deque once it has been drained here.
+    std::vector<Job> discarded;
+    for (auto& worker : m_workers)
+    {
+        if (worker->thread.joinable()) worker->thread.join();
+
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        std::move(worker->jobs.begin(), worker->jobs.end(), std::back_inserter(discarded));
+        worker->jobs.clear();
+    }
+    // Not reset to 0: a Submit that is racing with Stop may have counted its job and not yet backed it out.
+    m_queued -= discarded.size();
+
+    if (discarded.empty()) return;
+
+    CSSHARP_CORE_WARN("Discarded {} queued jobs on shutdown", discarded.size());
+
+    // Lets the owner of each job release whatever it was holding for it (e.g. the managed callbacks and the task waiting
+    // on them), since neither the work nor the continuation will ever be called.
+    for (auto& job : discarded)
+    {
+        if (job.discard) job.discard();
+    }
+}
+
+std::uint64_t JobSystem::Submit(std::function<void()>&& work,
+                                std::function<void()>&& continuation,
+                                std::function<void()>&& discard)
+{
+    if (!m_running.load()) return 0;
+
+    const auto id = m_nextJobId.fetch_add(1, std::memory_order_relaxed);
+    const auto target =
+        t_pool == this ? t_workerIndex : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+
+    // Counted before the job is published so a worker that takes it straight away never decrements below zero. A
+    // worker woken in between finds nothing yet and simply checks again.
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_queued++;
+    }
+
+    {
+        auto& worker = *m_workers[target];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        // Stop() may have drained this deque since the check above; the job would then never run or be discarded.
+        if (!m_running.load())
+        {
+            m_queued--;
+            return 0;
+        }
+
+        worker.jobs.push_back(
+            Job{ id, std::move(work), std::move(continuation), std::move(discard), std::chrono::steady_clock::now() });
+    }
+    m_wake.notify_one();
+
+    return id;
+}
+
+bool JobSystem::TakeJob(std::size_t index, Job& job)
+{
+    {
+        auto& own = *m_workers[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty())
+        {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            m_queued--;
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < m_workers.size(); offset++)
+    {
+        auto& victim = *m_workers[(index + offset) % m_workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            m_queued--;
+            m_stolen++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::Execute([[maybe_unused]] std::size_t index, Job& job)
+{
+    m_active++;
+    const auto started = std::chrono::steady_clock::now();
+    job.work();
+    const auto finished = std::chrono::steady_clock::now();
+    m_active--;
+
+    const auto waited = ElapsedMicroseconds(job.queuedAt, started);
+    const auto ran = ElapsedMicroseconds(started, finished);
+
+    m_completed++;
+    m_totalWaitMicroseconds += waited;
+    m_totalRunMicroseconds += ran;
+
+    auto max = m_maxRunMicroseconds.load(std::memory_order_relaxed);
+    while (ran > max && !m_maxRunMicroseconds.compare_exchange_weak(max, ran, std::memory_order_relaxed))
+    {
+    }
+
+    CSSHARP_CORE_TRACE_CATEGORY(TraceTasks, "Job {} ran for {}us on worker {} after waiting {}us", job.id, ran, index, waited);
+
+    if (job.continuation)
+    {
+        globals::mmPlugin->AddTaskForNextFrame(std::move(job.continuation));
+    }
+}
+
+void JobSystem::Run(std::size_t index)
+{
+    t_pool = this;
+    t_workerIndex = index;
+
+    while (m_running.load())
+    {
+        Job job;
+        if (TakeJob(index, job))
+        {
+            Execute(index, job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [this] { return m_queued.load() > 0 || !m_running.load(); });
+    }
+}
+
+void JobSystem::PinWorkers()
+{
+    // Only acts when the game thread has been pinned (e.g. with taskset); an unpinned game thread moves between cores,
+    // so there is no core to keep clear.
+#ifdef _WIN32
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) return;
+
+    // There is no GetThreadAffinityMask; setting the mask returns the previous one, which we then put back.
+    const auto gameMask = SetThreadAffinityMask(GetCurrentThread(), processMask);
+    if (gameMask == 0) return;
+    SetThreadAffinityMask(GetCurrentThread(), gameMask);
+
+    const auto workerMask = processMask & ~gameMask;
+    if (workerMask == 0) return;
+
+    for (auto& worker : m_workers)
+    {
+        SetThreadAffinityMask(worker->thread.native_handle(), workerMask);
+    }
+
+    CSSHARP_CORE_INFO("Pinned job threads away from the game thread's cores (mask {:#x})", static_cast<std::uint64_t>(workerMask));
+#else
+    cpu_set_t gameCores;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(gameCores), &gameCores) != 0) return;
+
+    const auto cores = std::min(static_cast<int>(std::thread::hardware_concurrency()), CPU_SETSIZE);
+
+    cpu_set_t workerCores;
+    CPU_ZERO(&workerCores);
+    for (int cpu = 0; cpu < cores; cpu++)
+    {
+        if (!CPU_ISSET(cpu, &gameCores)) CPU_SET(cpu, &workerCores);
+    }
+
+    if (CPU_COUNT(&workerCores) == 0) return;
+
+    for (auto& worker : m_workers)
+    {
+        pthread_setaffinity_np(worker->thread.native_handle(), sizeof(workerCores), &workerCores);
+    }
+
+    CSSHARP_CORE_INFO("Pinned job threads to {} cores away from the game thread", CPU_COUNT(&workerCores));
+#endif
+}
+
+JobSystem::Stats JobSystem::GetStats() const
+{
+    return Stats{ m_workers.size(),
+                  m_queued.load(),
+                  m_active.load(),
+                  m_completed.load(),
+                  m_stolen.load(),
+                  m_totalWaitMicroseconds.load(),
+                  m_totalRunMicroseconds.load(),
+                  m_maxRunMicroseconds.load() };
+}
+
+} // namespace counterstrikesharp
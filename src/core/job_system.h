@@ -0,0 +1,113 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace counterstrikesharp {
+
+/**
+ * Thread pool for plugin background work.
+ *
+ * Each worker keeps its own job deque: it takes its newest job first, and when it runs out it steals the oldest job
+ * from another worker. Jobs queued from outside the pool are spread across the workers in turn. A job can carry a
+ * continuation, which is queued for the next game frame once the job has finished, so results can be used on the game
+ * thread without any extra marshalling. Jobs that are still queued when the pool stops never run; their discard
+ * callback is invoked instead, on the thread that called Stop().
+ *
+ * If the game thread is pinned to a subset of cores when the pool starts, workers are pinned to the remaining cores.
+ */
+class JobSystem
+{
+  public:
+    struct Stats
+    {
+        std::size_t workers;
+        std::size_t queued;
+        std::size_t running;
+        std::uint64_t completed;
+        std::uint64_t stolen;
+        std::uint64_t totalWaitMicroseconds;
+        std::uint64_t totalRunMicroseconds;
+        std::uint64_t maxRunMicroseconds;
+    };
+
+    ~JobSystem();
+
+    // Game thread only. A thread count of 0 picks one from the number of cores.
+    void Start(int threadCount, bool avoidGameThreadCores);
+    void Stop();
+    [[nodiscard]] bool IsRunning() const { return m_running.load(); }
+
+    // Returns the job id, or 0 if the pool is not running.
+    std::uint64_t Submit(std::function<void()>&& work,
+                         std::function<void()>&& continuation = nullptr,
+                         std::function<void()>&& discard = nullptr);
+
+    [[nodiscard]] Stats GetStats() const;
+
+  private:
+    struct Job
+    {
+        std::uint64_t id;
+        std::function<void()> work;
+        std::function<void()> continuation;
+        std::function<void()> discard;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+        std::thread thread;
+    };
+
+    void Run(std::size_t index);
+    bool TakeJob(std::size_t index, Job& job);
+    void Execute(std::size_t index, Job& job);
+    void PinWorkers();
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_running{ false };
+    std::atomic<std::size_t> m_queued{ 0 };
+    std::atomic<std::size_t> m_active{ 0 };
+    std::atomic<std::size_t> m_nextWorker{ 0 };
+    std::atomic<std::uint64_t> m_nextJobId{ 1 };
+
+    std::atomic<std::uint64_t> m_completed{ 0 };
+    std::atomic<std::uint64_t> m_stolen{ 0 };
+    std::atomic<std::uint64_t> m_totalWaitMicroseconds{ 0 };
+    std::atomic<std::uint64_t> m_totalRunMicroseconds{ 0 };
+    std::atomic<std::uint64_t> m_maxRunMicroseconds{ 0 };
+};
+
+} // namespace counterstrikesharp
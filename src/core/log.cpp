@@ -1,11 +1,31 @@
 #include "core/log.h"
 
+#include <algorithm>
+#include <iterator>
+
+#include "core/async_log_sink.h"
+
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/cfg/env.h>
 
 namespace counterstrikesharp {
 std::shared_ptr<spdlog::logger> Log::m_core_logger;
+std::atomic<std::uint32_t> Log::m_traceCategories{ TraceAll };
+std::optional<spdlog::level::level_enum> Log::m_levelBeforeTrace;
+
+namespace {
+struct TraceCategoryName
+{
+    const char* name;
+    TraceCategory category;
+};
+
+constexpr TraceCategoryName kTraceCategoryNames[] = {
+    { "general", TraceGeneral },   { "events", TraceEvents }, { "hooks", TraceHooks }, { "commands", TraceCommands },
+    { "entities", TraceEntities }, { "players", TracePlayers }, { "tasks", TraceTasks }, { "usermessages", TraceUserMessages },
+};
+} // namespace
 
 void Log::Init()
 {
@@ -31,6 +51,89 @@ void Log::Init()
     spdlog::cfg::load_env_levels();
 }
 
+void Log::SetAsync(bool enabled, std::size_t queueSize, bool dropWhenFull)
+{
+    auto sinks = m_core_logger->sinks();
+    auto asyncSink = sinks.size() == 1 ? std::dynamic_pointer_cast<AsyncLogSink>(sinks[0]) : nullptr;
+    if (enabled == (asyncSink != nullptr)) return;
+
+    if (asyncSink)
+    {
+        CSSHARP_CORE_INFO("Async logging stopped: {} messages dropped, queue high-water mark {}", asyncSink->GetDroppedCount(),
+                          asyncSink->GetHighWaterMark());
+        sinks = asyncSink->GetSinks();
+    }
+    else
+    {
+        sinks = { std::make_shared<AsyncLogSink>(std::move(sinks), queueSize, dropWhenFull) };
+    }
+
+    auto logger = std::make_shared<spdlog::logger>(m_core_logger->name(), begin(sinks), end(sinks));
+    logger->set_level(m_core_logger->level());
+    // The async sink flushes on its own timer; flushing the file on every info line would undo that.
+    logger->flush_on(enabled ? spdlog::level::warn : spdlog::level::info);
+
+    m_core_logger->flush();
+    spdlog::drop(logger->name());
+    spdlog::register_logger(logger);
+    // Destroying the old logger (and its async sink) drains and joins the writer thread.
+    m_core_logger = logger;
+}
+
+void Log::SetTraceCategories(std::uint32_t categories)
+{
+    m_traceCategories.store(categories, std::memory_order_relaxed);
+
+    if (categories)
+    {
+        if (!m_levelBeforeTrace) m_levelBeforeTrace = m_core_logger->level();
+        m_core_logger->set_level(spdlog::level::trace);
+    }
+    else if (m_levelBeforeTrace)
+    {
+        // Puts back whatever SPDLOG_LEVEL (or the default) had set, e.g. after `css_trace off`.
+        m_core_logger->set_level(*m_levelBeforeTrace);
+        m_levelBeforeTrace.reset();
+    }
+}
+
+std::optional<std::uint32_t> Log::ParseTraceCategories(const std::vector<std::string>& names)
+{
+    std::uint32_t categories = 0;
+    for (const auto& name : names)
+    {
+        if (name == "all")
+        {
+            categories |= TraceAll;
+            continue;
+        }
+
+        auto it = std::find_if(std::begin(kTraceCategoryNames), std::end(kTraceCategoryNames),
+                               [&name](const TraceCategoryName& entry) { return name == entry.name; });
+        if (it == std::end(kTraceCategoryNames)) return std::nullopt;
+
+        categories |= it->category;
+    }
+
+    return categories;
+}
+
+std::string Log::FormatTraceCategories(std::uint32_t categories)
+{
+    if (categories == TraceAll) return "all";
+
+    std::string result;
+    for (const auto& entry : kTraceCategoryNames)
+    {
+        if (!(categories & entry.category)) continue;
+
+        if (!result.empty()) result += ' ';
+        result += entry.name;
+    }
+
+    return result.empty() ? "none" : result;
+}
+
 void Log::Close()
 {
     spdlog::drop("CSSharp");
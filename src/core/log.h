@@ -1,25 +1,78 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/spdlog.h>
 
 namespace counterstrikesharp {
+
+// Subsystems whose trace logging can be switched on separately, see Log::SetTraceCategories.
+enum TraceCategory : std::uint32_t
+{
+    TraceGeneral = 1 << 0,
+    TraceEvents = 1 << 1,
+    TraceHooks = 1 << 2,
+    TraceCommands = 1 << 3,
+    TraceEntities = 1 << 4,
+    TracePlayers = 1 << 5,
+    TraceTasks = 1 << 6,
+    TraceUserMessages = 1 << 7,
+    TraceAll = 0xFFFFFFFF,
+};
+
 class Log
 {
   public:
     static void Init();
     static void Close();
+    // Moves writing to the console and log file onto a background thread, or back onto the calling thread.
+    static void SetAsync(bool enabled, std::size_t queueSize, bool dropWhenFull);
 
     static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return m_core_logger; }
 
+    // Checked before a trace message's arguments are evaluated.
+    static bool ShouldTrace(TraceCategory category)
+    {
+        return (m_traceCategories.load(std::memory_order_relaxed) & category) && m_core_logger->should_log(spdlog::level::trace);
+    }
+
+    // Limits trace logging to the given categories and switches the core logger to trace level, or back to the level it
+    // had before tracing was switched on when categories is 0.
+    static void SetTraceCategories(std::uint32_t categories);
+    static std::uint32_t GetTraceCategories() { return m_traceCategories.load(std::memory_order_relaxed); }
+
+    // Parses category names such as "events" or "all"; nullopt if any name is unknown.
+    static std::optional<std::uint32_t> ParseTraceCategories(const std::vector<std::string>& names);
+    static std::string FormatTraceCategories(std::uint32_t categories);
+
   private:
     static std::shared_ptr<spdlog::logger> m_core_logger;
+    static std::atomic<std::uint32_t> m_traceCategories;
+    // Set while SetTraceCategories has the core logger at trace level.
+    static std::optional<spdlog::level::level_enum> m_levelBeforeTrace;
 };
 } // namespace counterstrikesharp
 
-#define CSSHARP_CORE_TRACE(...)    ::counterstrikesharp::Log::GetCoreLogger()->trace(__VA_ARGS__)
+// Trace sites are compiled out entirely when built with CSSHARP_TRACE=OFF.
+#ifdef CSSHARP_DISABLE_TRACE
+#define CSSHARP_CORE_TRACE_CATEGORY(category, ...) ((void)0)
+#else
+#define CSSHARP_CORE_TRACE_CATEGORY(category, ...)                                                                                   \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        if (::counterstrikesharp::Log::ShouldTrace(category)) ::counterstrikesharp::Log::GetCoreLogger()->trace(__VA_ARGS__);      \
+    } while (0)
+#endif
+
+#define CSSHARP_CORE_TRACE(...)    CSSHARP_CORE_TRACE_CATEGORY(::counterstrikesharp::TraceGeneral, __VA_ARGS__)
 #define CSSHARP_CORE_DEBUG(...)    ::counterstrikesharp::Log::GetCoreLogger()->debug(__VA_ARGS__)
 #define CSSHARP_CORE_INFO(...)     ::counterstrikesharp::Log::GetCoreLogger()->info(__VA_ARGS__)
 #define CSSHARP_CORE_WARN(...)     ::counterstrikesharp::Log::GetCoreLogger()->warn(__VA_ARGS__)
@@ -16,6 +16,8 @@
 
 #include "core/managers/chat_manager.h"
 
+#include <cctype>
+#include <cstring>
 #include <funchook.h>
 #include <igameevents.h>
 #include <public/eiface.h>
@@ -67,32 +69,66 @@ void DetourHostSay(CEntityInstance* pController, CCommand& args, bool teamonly,
         }
     }
 
-    std::string prefix;
-    bool bSilent = globals::coreConfig->IsSilentChatTrigger(args[1], prefix);
-    bool bCommand = globals::coreConfig->IsPublicChatTrigger(args[1], prefix) || bSilent;
+    std::string_view message = args[1];
+    std::string_view silentPrefix, publicPrefix;
+    bool bSilent = globals::coreConfig->IsSilentChatTrigger(message, silentPrefix);
+    bool bPublic = globals::coreConfig->IsPublicChatTrigger(message, publicPrefix);
+    bool bCommand = bPublic || bSilent;
 
     if (!bSilent)
     {
         m_pHostSay(pController, args, teamonly, unk1, unk2);
     }
 
+    // `say` itself went through the console flood limiter, so a dropped message doesn't dispatch a chat command either.
+    if (bCommand && pController && globals::conCommandManager.floodLimiter.IsLimited(pController->GetEntityIndex().Get() - 1))
+    {
+        bCommand = false;
+    }
+
     if (bCommand)
     {
-        char* pszMessage = (char*)(args.ArgS() + prefix.length() + 1);
+        auto prefixLength = bPublic ? publicPrefix.length() : silentPrefix.length();
+        char* pszMessage = (char*)(args.ArgS() + prefixLength + 1);
 
         // Trailing slashes are only removed if Host_Say has been called.
         if (bSilent) pszMessage[V_strlen(pszMessage) - 1] = 0;
 
-        CCommand args;
-        args.Tokenize(pszMessage);
+        // When the message starts with a plain word, that word is the first token whether or not it is
+        // prefixed, so we can check for a `css_` command up front and tokenize exactly once.
+        auto nameLength = strcspn(pszMessage, " \t\n\r\"{}()':");
+        auto messageLength = nameLength + V_strlen(pszMessage + nameLength);
+        bool bPlainName = nameLength > 0 && (pszMessage[nameLength] == '\0' || isspace(static_cast<unsigned char>(pszMessage[nameLength])));
 
-        auto prefixedPhrase = std::string("css_") + args.Arg(0);
-        auto bValidWithPrefix = globals::conCommandManager.IsValidValveCommand(prefixedPhrase.c_str());
+        char szPrefixed[512];
+        CCommand args;
 
-        if (bValidWithPrefix)
+        if (bPlainName && messageLength + 4 < sizeof(szPrefixed))
+        {
+            memcpy(szPrefixed, "css_", 4);
+            memcpy(szPrefixed + 4, pszMessage, nameLength);
+            szPrefixed[4 + nameLength] = '\0';
+
+            if (globals::conCommandManager.IsValidValveCommand(szPrefixed))
+            {
+                memcpy(szPrefixed + 4, pszMessage, messageLength + 1);
+                args.Tokenize(szPrefixed);
+            }
+            else
+            {
+                args.Tokenize(pszMessage);
+            }
+        }
+        else
         {
-            // Re-tokenize with a `css_` prefix if we have found that its a valid command.
-            args.Tokenize(("css_" + std::string(pszMessage)).c_str());
+            args.Tokenize(pszMessage);
+
+            auto prefixedPhrase = std::string("css_") + args.Arg(0);
+            if (globals::conCommandManager.IsValidValveCommand(prefixedPhrase.c_str()))
+            {
+                // Re-tokenize with a `css_` prefix if we have found that its a valid command.
+                args.Tokenize(("css_" + std::string(pszMessage)).c_str());
+            }
         }
 
         globals::chatManager.OnSayCommandPost(pController, args);
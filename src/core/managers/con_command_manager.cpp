@@ -93,6 +93,32 @@ json WriteTypeJson(json obj, CSchemaType* current_type)
     return obj;
 }
 
+CON_COMMAND(css_trace, "Show or set the core trace log categories, e.g. \"css_trace events hooks\", \"css_trace all\" or \"css_trace off\"")
+{
+    if (args.ArgC() < 2)
+    {
+        META_CONPRINTF("Trace categories: %s\n", Log::FormatTraceCategories(Log::GetTraceCategories()).c_str());
+        return;
+    }
+
+    std::vector<std::string> names;
+    for (int i = 1; i < args.ArgC(); i++)
+    {
+        names.emplace_back(args.Arg(i));
+    }
+
+    std::optional<std::uint32_t> categories = names.size() == 1 && names[0] == "off" ? 0 : Log::ParseTraceCategories(names);
+    if (!categories)
+    {
+        META_CONPRINT("Unknown trace category. Valid categories: general events hooks commands entities players tasks usermessages "
+                      "all off\n");
+        return;
+    }
+
+    Log::SetTraceCategories(*categories);
+    META_CONPRINTF("Trace categories: %s\n", Log::FormatTraceCategories(*categories).c_str());
+}
+
 CON_COMMAND(dump_schema, "dump schema symbols")
 {
     std::ofstream output(utils::GamedataDirectory() + "/schema.json");
@@ -279,13 +305,13 @@ void ConCommandManager::AddCommandListener(const char* name, CallbackT callback,
         return;
     }
 
-    auto strName = std::string(name);
-    ConCommandInfo* pInfo = m_cmd_lookup[strName];
+    auto ppInfo = m_cmd_lookup.Find(name);
+    ConCommandInfo* pInfo = ppInfo ? *ppInfo : nullptr;
 
     if (!pInfo)
     {
         pInfo = new ConCommandInfo();
-        m_cmd_lookup[strName] = pInfo;
+        m_cmd_lookup.Insert(name, pInfo);
 
         ConCommandRef hExistingCommand = globals::cvars->FindConCommand(name);
         if (hExistingCommand.IsValidRef())
@@ -319,8 +345,8 @@ void ConCommandManager::RemoveCommandListener(const char* name, CallbackT callba
         return;
     }
 
-    auto strName = std::string(name);
-    ConCommandInfo* pInfo = m_cmd_lookup[strName];
+    auto ppInfo = m_cmd_lookup.Find(name);
+    ConCommandInfo* pInfo = ppInfo ? *ppInfo : nullptr;
 
     if (!pInfo)
     {
@@ -344,12 +370,13 @@ bool ConCommandManager::AddValveCommand(const char* name, const char* descriptio
 
     auto conCommand = new ConCommand(strdup(name), CommandCallback, description ? strdup(description) : "", flags);
 
-    ConCommandInfo* pInfo = m_cmd_lookup[std::string(name)];
+    auto ppInfo = m_cmd_lookup.Find(name);
+    ConCommandInfo* pInfo = ppInfo ? *ppInfo : nullptr;
 
     if (!pInfo)
     {
         pInfo = new ConCommandInfo();
-        m_cmd_lookup[std::string(name)] = pInfo;
+        m_cmd_lookup.Insert(name, pInfo);
     }
 
     pInfo->command = conCommand->GetRawData();
@@ -369,12 +396,14 @@ bool ConCommandManager::RemoveValveCommand(const char* name)
 
     globals::cvars->UnregisterConCommandCallbacks(hFoundCommand);
 
-    auto pInfo = m_cmd_lookup[std::string(name)];
-    if (!pInfo)
+    auto ppInfo = m_cmd_lookup.Find(name);
+    if (!ppInfo || !*ppInfo)
     {
         return true;
     }
 
+    auto pInfo = *ppInfo;
+
     pInfo->command = nullptr;
 
     return true;
@@ -383,14 +412,22 @@ bool ConCommandManager::RemoveValveCommand(const char* name)
 HookResult ConCommandManager::ExecuteCommandCallbacks(
     const char* name, const CCommandContext& ctx, const CCommand& args, HookMode mode, CommandCallingContext callingContext)
 {
-    CSSHARP_CORE_TRACE("[ConCommandManager::ExecuteCommandCallbacks][{}]: {}", mode == Pre ? "Pre" : "Post", name);
-    ConCommandInfo* pInfo = m_cmd_lookup[std::string(name)];
+    CSSHARP_CORE_TRACE_CATEGORY(TraceCommands, "[ConCommandManager::ExecuteCommandCallbacks][{}]: {}", mode == Pre ? "Pre" : "Post", name);
+    auto ppInfo = m_cmd_lookup.Find(name);
+    ConCommandInfo* pInfo = ppInfo ? *ppInfo : nullptr;
 
     HookResult result = HookResult::Continue;
 
     auto globalCallback = mode == HookMode::Pre ? m_global_cmd.callback_pre : m_global_cmd.callback_post;
 
-    m_cmd_contexts[&args] = callingContext;
+    struct CallingContextScope
+    {
+        std::vector<std::pair<const CCommand*, CommandCallingContext>>& stack;
+        ~CallingContextScope() { stack.pop_back(); }
+    };
+
+    m_cmd_contexts.emplace_back(&args, callingContext);
+    CallingContextScope contextScope{ m_cmd_contexts };
 
     if (globalCallback->GetFunctionCount() > 0)
     {
@@ -425,7 +462,6 @@ HookResult ConCommandManager::ExecuteCommandCallbacks(
 
     if (!pInfo)
     {
-        m_cmd_contexts.erase(&args);
         return result;
     }
 
@@ -444,7 +480,6 @@ HookResult ConCommandManager::ExecuteCommandCallbacks(
 
         if (thisResult >= HookResult::Handled)
         {
-            m_cmd_contexts.erase(&args);
             return thisResult;
         }
         else if (thisResult > result)
@@ -453,8 +488,6 @@ HookResult ConCommandManager::ExecuteCommandCallbacks(
         }
     }
 
-    m_cmd_contexts.erase(&args);
-
     return result;
 }
 
@@ -462,7 +495,14 @@ void ConCommandManager::Hook_DispatchConCommand(ConCommandRef cmd, const CComman
 {
     const char* name = args.Arg(0);
 
-    CSSHARP_CORE_TRACE("[ConCommandManager::Hook_DispatchConCommand]: {}", name);
+    CSSHARP_CORE_TRACE_CATEGORY(TraceCommands, "[ConCommandManager::Hook_DispatchConCommand]: {}", name);
+
+    // Excess client commands are dropped outright. Letting them through to the game while skipping our callbacks would
+    // let a flooding client get past plugin vetoes (gagged `say`, blocked `jointeam`, admin-only commands).
+    if (!floodLimiter.TryConsume(ctx.GetPlayerSlot().Get()))
+    {
+        RETURN_META(MRES_SUPERCEDE);
+    }
 
     auto result = ExecuteCommandCallbacks(name, ctx, args, HookMode::Pre, CommandCallingContext::Console);
     if (result >= HookResult::Handled)
@@ -474,6 +514,11 @@ void ConCommandManager::Hook_DispatchConCommand_Post(ConCommandRef cmd, const CC
 {
     const char* name = args.Arg(0);
 
+    if (floodLimiter.IsLimited(ctx.GetPlayerSlot().Get()))
+    {
+        RETURN_META(MRES_IGNORED);
+    }
+
     auto result = ExecuteCommandCallbacks(name, ctx, args, HookMode::Post, CommandCallingContext::Console);
     if (result >= HookResult::Handled)
     {
@@ -486,6 +531,14 @@ bool ConCommandManager::IsValidValveCommand(const char* name)
     return pCmd.IsValidRef();
 }
 
-CommandCallingContext ConCommandManager::GetCommandCallingContext(CCommand* args) { return m_cmd_contexts[args]; }
+CommandCallingContext ConCommandManager::GetCommandCallingContext(CCommand* args)
+{
+    for (auto it = m_cmd_contexts.rbegin(); it != m_cmd_contexts.rend(); ++it)
+    {
+        if (it->first == args) return it->second;
+    }
+
+    return CommandCallingContext::Console;
+}
 
 } // namespace counterstrikesharp
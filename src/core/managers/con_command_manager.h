@@ -31,25 +31,17 @@
 
 #pragma once
 
-#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "core/case_insensitive_hash_map.h"
+#include "core/command_flood_limiter.h"
 #include "core/global_listener.h"
 #include "core/globals.h"
 #include "playerslot.h"
 #include "scripting/script_engine.h"
 
-struct CaseInsensitiveComparator
-{
-    bool operator()(const std::string& lhs, const std::string& rhs) const
-    {
-        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char a, char b) {
-            return std::tolower(a) < std::tolower(b);
-        });
-    }
-};
-
 namespace counterstrikesharp {
 
 void UnlockConVars();
@@ -106,10 +98,13 @@ class ConCommandManager : public GlobalClass
 
     CommandCallingContext GetCommandCallingContext(CCommand* args);
 
+    CommandFloodLimiter floodLimiter;
+
   private:
     std::vector<ConCommandInfo*> m_cmd_list;
-    std::map<std::string, ConCommandInfo*, CaseInsensitiveComparator> m_cmd_lookup;
-    std::map<const CCommand*, CommandCallingContext> m_cmd_contexts;
+    CaseInsensitiveHashMap<ConCommandInfo*> m_cmd_lookup;
+    // Commands can dispatch other commands from within their callbacks, so contexts nest.
+    std::vector<std::pair<const CCommand*, CommandCallingContext>> m_cmd_contexts;
     ConCommandInfo m_global_cmd = ConCommandInfo(true);
 };
 
@@ -110,8 +110,33 @@ void EntityManager::OnShutdown()
     SH_REMOVE_HOOK_MEMFUNC(ISource2GameEntities, CheckTransmit, globals::gameEntities, this, &EntityManager::CheckTransmit, true);
 }
 
+void EntityManager::OnLevelEnd()
+{
+    spatialIndex.Clear();
+    m_entityPointers.clear();
+    m_entityPointersPopulated = false;
+}
+
+bool EntityManager::IsEntityPointer(const void* pointer)
+{
+    if (pointer == nullptr || !globals::entitySystem) return false;
+
+    if (!m_entityPointersPopulated)
+    {
+        for (auto pIdentity = globals::entitySystem->m_EntityList.m_pFirstActiveEntity; pIdentity; pIdentity = pIdentity->m_pNext)
+        {
+            if (pIdentity->m_pInstance) m_entityPointers.insert(pIdentity->m_pInstance);
+        }
+        m_entityPointersPopulated = true;
+    }
+
+    return m_entityPointers.count(pointer) != 0;
+}
+
 void CEntityListener::OnEntitySpawned(CEntityInstance* pEntity)
 {
+    globals::entityManager.spatialIndex.OnEntitySpawned(pEntity);
+
     auto callback = globals::entityManager.on_entity_spawned_callback;
 
     if (callback && callback->GetFunctionCount())
@@ -123,6 +148,8 @@ void CEntityListener::OnEntitySpawned(CEntityInstance* pEntity)
 }
 void CEntityListener::OnEntityCreated(CEntityInstance* pEntity)
 {
+    if (globals::entityManager.m_entityPointersPopulated) globals::entityManager.m_entityPointers.insert(pEntity);
+
     auto callback = globals::entityManager.on_entity_created_callback;
 
     if (callback && callback->GetFunctionCount())
@@ -134,6 +161,10 @@ void CEntityListener::OnEntityCreated(CEntityInstance* pEntity)
 }
 void CEntityListener::OnEntityDeleted(CEntityInstance* pEntity)
 {
+    globals::entityManager.spatialIndex.OnEntityDeleted(pEntity);
+    globals::entityManager.entityData.OnEntityDeleted(pEntity->GetRefEHandle().ToInt());
+    globals::entityManager.m_entityPointers.erase(pEntity);
+
     auto callback = globals::entityManager.on_entity_deleted_callback;
 
     if (callback && callback->GetFunctionCount())
@@ -233,7 +264,8 @@ void DetourFireOutputInternal(
 
     if (pCaller)
     {
-        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, {}", pThis->m_pDesc->m_pName, pCaller->GetClassname());
+        CSSHARP_CORE_TRACE_CATEGORY(TraceEntities, "[EntityManager][FireOutputHook] - {}, {}", pThis->m_pDesc->m_pName,
+                                    pCaller->GetClassname());
 
         auto& hookMap = globals::entityManager.m_pHookMap;
 
@@ -247,7 +279,7 @@ void DetourFireOutputInternal(
         }
     }
     else
-        CSSHARP_CORE_TRACE("[EntityManager][FireOutputHook] - {}, unknown caller", pThis->m_pDesc->m_pName);
+        CSSHARP_CORE_TRACE_CATEGORY(TraceEntities, "[EntityManager][FireOutputHook] - {}, unknown caller", pThis->m_pDesc->m_pName);
 
     HookResult result = HookResult::Continue;
 
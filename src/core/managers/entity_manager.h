@@ -17,8 +17,11 @@
 #pragma once
 
 #include <map>
+#include <unordered_set>
 #include <vector>
 
+#include "core/entity_data_store.h"
+#include "core/entity_spatial_index.h"
 #include "core/globals.h"
 #include "core/global_listener.h"
 #include "scripting/script_engine.h"
@@ -61,9 +64,14 @@ class EntityManager : public GlobalClass
     ~EntityManager();
     void OnAllInitialized() override;
     void OnShutdown() override;
+    void OnLevelEnd() override;
     void HookEntityOutput(const char* szClassname, const char* szOutput, CallbackT fnCallback, HookMode mode);
     void UnhookEntityOutput(const char* szClassname, const char* szOutput, CallbackT fnCallback, HookMode mode);
+    // Whether pointer is a live entity instance, checked without dereferencing it.
+    bool IsEntityPointer(const void* pointer);
     CEntityListener entityListener;
+    EntitySpatialIndex spatialIndex;
+    EntityDataStore entityData;
     std::map<OutputKey_t, CallbackPair*> m_pHookMap;
 
   private:
@@ -82,6 +90,10 @@ class EntityManager : public GlobalClass
     ScriptCallback* check_transmit;
 
     std::string m_profile_name;
+
+    // Built from the active entity list on first use, then kept current by the entity listener until the level ends.
+    std::unordered_set<const void*> m_entityPointers;
+    bool m_entityPointersPopulated = false;
 };
 
 enum EntityIOTargetType_t
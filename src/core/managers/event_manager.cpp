@@ -86,7 +86,7 @@ bool EventManager::HookEvent(const char* szName, CallbackT fnCallback, bool bPos
         return true;
     }
 
-    CSSHARP_CORE_TRACE("[EventManager] Hooking event: {0} with callback pointer: {1}", szName, (void*)fnCallback);
+    CSSHARP_CORE_TRACE_CATEGORY(TraceEvents, "[EventManager] Hooking event: {0} with callback pointer: {1}", szName, (void*)fnCallback);
 
     if (!globals::gameEventManager->FindListener(this, szName))
     {
@@ -181,7 +181,7 @@ bool EventManager::UnhookEvent(const char* szName, CallbackT fnCallback, bool bP
         }
     }
 
-    CSSHARP_CORE_TRACE("Unhooking event: {0} with callback pointer: {1}", szName, (void*)fnCallback);
+    CSSHARP_CORE_TRACE_CATEGORY(TraceEvents, "Unhooking event: {0} with callback pointer: {1}", szName, (void*)fnCallback);
 
     return true;
 }
@@ -205,8 +205,8 @@ bool EventManager::OnFireEvent(IGameEvent* pEvent, bool bDontBroadcast)
 
         if (pCallback)
         {
-            CSSHARP_CORE_TRACE("Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}", szName, (void*)pEvent, bDontBroadcast,
-                               false);
+            CSSHARP_CORE_TRACE_CATEGORY(TraceEvents, "Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}", szName, (void*)pEvent,
+                                        bDontBroadcast, false);
             EventOverride override = { bDontBroadcast };
             pCallback->Reset();
             pCallback->ScriptContext().Push(pEvent);
@@ -262,8 +262,8 @@ bool EventManager::OnFireEventPost(IGameEvent* pEvent, bool bDontBroadcast)
             VPROF_BUDGET("CS#::OnFireEventPost", "CS# Event Hooks");
 
             auto pEventCopy = m_EventCopies.top();
-            CSSHARP_CORE_TRACE("Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}", pEventCopy->GetName(), (void*)pEventCopy,
-                               bDontBroadcast, true);
+            CSSHARP_CORE_TRACE_CATEGORY(TraceEvents, "Pushing event `{}` pointer: {}, dont broadcast: {}, post: {}", pEventCopy->GetName(),
+                                        (void*)pEventCopy, bDontBroadcast, true);
             EventOverride override = { bDontBroadcast };
             pCallback->Reset();
             pCallback->ScriptContext().Push(pEventCopy);
@@ -33,11 +33,14 @@
 #include "core/managers/con_command_manager.h"
 #include "core/managers/voice_manager.h"
 
+#include <algorithm>
+
 #include <public/eiface.h>
 #include <public/inetchannelinfo.h>
 #include <public/iserver.h>
 #include <sourcehook/sourcehook.h>
 
+#include "core/coreconfig.h"
 #include "core/log.h"
 #include "core/timer_system.h"
 #include "scripting/callback_manager.h"
@@ -108,7 +111,7 @@ void PlayerManager::OnShutdown()
 bool PlayerManager::OnClientConnect(
     CPlayerSlot slot, const char* pszName, uint64 xuid, const char* pszNetworkID, bool unk1, CBufferString* pRejectReason)
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientConnect] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientConnect] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
 
     int client = slot.Get();
     CPlayer* pPlayer = &m_players[client];
@@ -149,13 +152,20 @@ bool PlayerManager::OnClientConnect(
 
     m_user_id_lookup[globals::engine->GetPlayerUserId(slot).Get()] = client;
 
+    globals::conCommandManager.floodLimiter.Reset(client);
+
+    if (!pPlayer->IsFakeClient())
+    {
+        AddPendingAuth(client);
+    }
+
     return true;
 }
 
 bool PlayerManager::OnClientConnect_Post(
     CPlayerSlot slot, const char* pszName, uint64 xuid, const char* pszNetworkID, bool unk1, CBufferString* pRejectReason)
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientConnect_Post] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientConnect_Post] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
 
     int client = slot.Get();
     bool orig_value = META_RESULT_ORIG_RET(bool);
@@ -182,7 +192,7 @@ bool PlayerManager::OnClientConnect_Post(
 
 void PlayerManager::OnClientPutInServer(CPlayerSlot slot, char const* pszName, int type, uint64 xuid)
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientPutInServer] - {}, {}, {}", slot.Get(), pszName, type);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientPutInServer] - {}, {}, {}", slot.Get(), pszName, type);
 
     int client = slot.Get();
     CPlayer* pPlayer = &m_players[client];
@@ -210,6 +220,13 @@ void PlayerManager::OnClientPutInServer(CPlayerSlot slot, char const* pszName, i
     pPlayer->Connect();
     m_player_count++;
 
+    // Steam usually finishes validating the ticket while the client is loading, so try here
+    // before falling back to the periodic check.
+    if (!pPlayer->IsFakeClient() && !pPlayer->IsAuthorized() && globals::engine->IsClientFullyAuthenticated(client))
+    {
+        AuthorizePlayer(pPlayer);
+    }
+
     //    globals::entityListener.HandleEntityCreated(pPlayer->GetBaseEntity(), client);
     //    globals::entityListener.HandleEntitySpawned(pPlayer->GetBaseEntity(), client);
 
@@ -221,7 +238,7 @@ void PlayerManager::OnClientPutInServer(CPlayerSlot slot, char const* pszName, i
 void PlayerManager::OnClientDisconnect(
     CPlayerSlot slot, ENetworkDisconnectionReason reason, const char* pszName, uint64 xuid, const char* pszNetworkID)
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientDisconnect] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientDisconnect] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
 
     int client = slot.Get();
     CPlayer* pPlayer = &m_players[client];
@@ -245,7 +262,7 @@ void PlayerManager::OnClientDisconnect(
 void PlayerManager::OnClientDisconnect_Post(
     CPlayerSlot slot, ENetworkDisconnectionReason reason, const char* pszName, uint64 xuid, const char* pszNetworkID) const
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientDisconnect_Post] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientDisconnect_Post] - {}, {}, {}", slot.Get(), pszName, pszNetworkID);
 
     int client = slot.Get();
     CPlayer* pPlayer = &m_players[client];
@@ -265,7 +282,7 @@ void PlayerManager::OnClientDisconnect_Post(
 
 void PlayerManager::OnClientVoice(CPlayerSlot slot) const
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientVoice] - {}", slot.Get());
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientVoice] - {}", slot.Get());
 
     m_on_client_voice_callback->ScriptContext().Reset();
     m_on_client_voice_callback->ScriptContext().Push(slot.Get());
@@ -274,7 +291,7 @@ void PlayerManager::OnClientVoice(CPlayerSlot slot) const
 
 void PlayerManager::OnLevelEnd()
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnLevelEnd]");
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnLevelEnd]");
 
     for (int i = 0; i <= MaxClients(); i++)
     {
@@ -291,7 +308,7 @@ void PlayerManager::OnLevelEnd()
 
 void PlayerManager::OnClientCommand(CPlayerSlot slot, const CCommand& args) const
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnClientCommand] - {}, {}, {}", slot.Get(), args.Arg(0), (void*)&args);
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnClientCommand] - {}, {}, {}", slot.Get(), args.Arg(0), (void*)&args);
 
     const char* cmd = args.Arg(0);
 
@@ -443,34 +460,58 @@ PlayerManager::PlayerManager()
     memset(m_user_id_lookup, 0, sizeof(int) * (USHRT_MAX + 1));
 }
 
+void PlayerManager::AddPendingAuth(int client)
+{
+    if (std::find(m_pending_auth.begin(), m_pending_auth.end(), client) == m_pending_auth.end())
+    {
+        m_pending_auth.push_back(client);
+    }
+}
+
+void PlayerManager::AuthorizePlayer(CPlayer* pPlayer) const
+{
+    pPlayer->Authorize();
+    pPlayer->SetSteamId(globals::engine->GetClientSteamID(pPlayer->m_slot.Get()));
+    OnAuthorized(pPlayer);
+}
+
 void PlayerManager::RunAuthChecks()
 {
-    if (globals::timerSystem.GetTickedTime() - m_last_auth_check_time < 0.5F)
+    if (m_pending_auth.empty())
+    {
+        return;
+    }
+
+    if (globals::timerSystem.GetTickedTime() - m_last_auth_check_time < globals::coreConfig->AuthCheckInterval)
     {
         return;
     }
 
     m_last_auth_check_time = globals::timerSystem.GetTickedTime();
 
-    for (int i = 0; i <= MaxClients(); i++)
+    // Walk backwards so entries can be swap-removed; anything added from within an
+    // OnClientAuthorized callback is picked up on the next check.
+    for (int i = static_cast<int>(m_pending_auth.size()) - 1; i >= 0; i--)
     {
-        if (m_players[i].IsConnected())
+        CPlayer* pPlayer = &m_players[m_pending_auth[i]];
+        bool pending = pPlayer->IsConnected() && !pPlayer->IsAuthorized() && !pPlayer->IsFakeClient();
+
+        if (pending && !globals::engine->IsClientFullyAuthenticated(pPlayer->m_slot.Get())) continue;
+
+        m_pending_auth[i] = m_pending_auth.back();
+        m_pending_auth.pop_back();
+
+        if (pending)
         {
-            if (m_players[i].IsAuthorized() || m_players[i].IsFakeClient()) continue;
-
-            if (globals::engine->IsClientFullyAuthenticated(i))
-            {
-                m_players[i].Authorize();
-                m_players[i].SetSteamId(globals::engine->GetClientSteamID(i));
-                OnAuthorized(&m_players[i]);
-            }
+            AuthorizePlayer(pPlayer);
         }
     }
 }
 
 void PlayerManager::OnAuthorized(CPlayer* player) const
 {
-    CSSHARP_CORE_TRACE("[PlayerManager][OnAuthorized] - {} {}", player->GetName(), player->GetSteamId()->ConvertToUint64());
+    CSSHARP_CORE_TRACE_CATEGORY(TracePlayers, "[PlayerManager][OnAuthorized] - {} {}", player->GetName(),
+                                player->GetSteamId()->ConvertToUint64());
 
     m_on_client_authorized_callback->ScriptContext().Reset();
     m_on_client_authorized_callback->ScriptContext().Push(player->m_slot.Get());
@@ -538,9 +579,28 @@ float CPlayer::GetTimeConnected() const
     return GetNetInfo()->GetTimeConnected();
 }
 
-void CPlayer::SetListen(CPlayerSlot slot, ListenOverride listen) { m_listenMap[slot.Get()] = listen; }
+void CPlayer::SetListen(CPlayerSlot slot, ListenOverride listen)
+{
+    m_listenMap[slot.Get()] = listen;
+    globals::voiceManager.MarkDirty(m_slot.Get());
+}
 
-void CPlayer::SetVoiceFlags(VoiceFlag_t flags) { m_voiceFlag = flags; }
+void CPlayer::SetListenMasks(uint64 muteMask, uint64 hearMask)
+{
+    for (int i = 0; i < 64; i++)
+    {
+        auto bit = 1ull << i;
+        m_listenMap[i] = (muteMask & bit) ? Listen_Mute : (hearMask & bit) ? Listen_Hear : Listen_Default;
+    }
+
+    globals::voiceManager.MarkDirty(m_slot.Get());
+}
+
+void CPlayer::SetVoiceFlags(VoiceFlag_t flags)
+{
+    m_voiceFlag = flags;
+    globals::voiceManager.MarkAllDirty();
+}
 
 VoiceFlag_t CPlayer::GetVoiceFlags() { return m_voiceFlag; }
 
@@ -569,6 +629,7 @@ void CPlayer::Disconnect()
     m_selfMutes->ClearAll();
     memset(m_listenMap, 0, sizeof m_listenMap);
     m_voiceFlag = 0;
+    globals::voiceManager.MarkAllDirty();
 }
 
 QAngle CPlayer::GetAbsAngles() const { return m_info->GetAbsAngles(); }
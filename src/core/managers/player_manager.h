@@ -32,6 +32,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "core/global_listener.h"
 #include "core/globals.h"
@@ -112,6 +113,7 @@ class CPlayer
     int GetUserId() const;
     float GetTimeConnected() const;
     void SetListen(CPlayerSlot slot, ListenOverride listen);
+    void SetListenMasks(uint64 muteMask, uint64 hearMask);
     void SetVoiceFlags(VoiceFlag_t flags);
     VoiceFlag_t GetVoiceFlags();
     ListenOverride GetListen(CPlayerSlot slot) const;
@@ -170,6 +172,8 @@ class PlayerManager : public GlobalClass
 
   private:
     void InvalidatePlayer(CPlayer* pPlayer) const;
+    void AddPendingAuth(int client);
+    void AuthorizePlayer(CPlayer* pPlayer) const;
 
     CPlayer* m_players;
     int m_max_clients = 0;
@@ -178,6 +182,7 @@ class PlayerManager : public GlobalClass
     int m_listen_client;
     bool m_is_listen_server;
     float m_last_auth_check_time = 0;
+    std::vector<int> m_pending_auth;
 
     ScriptCallback* m_on_client_connect_callback;
     ScriptCallback* m_on_client_put_in_server_callback;
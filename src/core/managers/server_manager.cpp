@@ -16,6 +16,7 @@
 
 #include "core/managers/server_manager.h"
 
+#include "core/coreconfig.h"
 #include "core/log.h"
 #include "scripting/callback_manager.h"
 
@@ -170,18 +171,12 @@ void ServerManager::UpdateWhenNotInGame(float flFrameTime)
 
 void ServerManager::PreWorldUpdate(bool bSimulating)
 {
-    std::vector<std::function<void()>> out_list(1024);
-
-    auto size = m_nextWorldUpdateTasks.try_dequeue_bulk(out_list.begin(), 1024);
+    m_nextWorldUpdateTasks.Drain();
 
+    auto size = m_nextWorldUpdateTasks.Run(std::chrono::microseconds(globals::coreConfig->TaskFrameBudget));
     if (size > 0)
     {
-        CSSHARP_CORE_TRACE("Executing queued tasks of size: {0} at time {1}", size, globals::getGlobalVars()->curtime);
-
-        for (size_t i = 0; i < size; i++)
-        {
-            out_list[i]();
-        }
+        CSSHARP_CORE_TRACE_CATEGORY(TraceTasks, "Executed queued tasks of size: {0} at time {1}", size, globals::getGlobalVars()->curtime);
     }
 
     auto callback = globals::serverManager.on_server_pre_world_update;
@@ -194,9 +189,9 @@ void ServerManager::PreWorldUpdate(bool bSimulating)
     }
 }
 
-void ServerManager::AddTaskForNextWorldUpdate(std::function<void()>&& task)
+void ServerManager::AddTaskForNextWorldUpdate(std::function<void()>&& task, TaskPriority priority)
 {
-    m_nextWorldUpdateTasks.enqueue(std::forward<decltype(task)>(task));
+    m_nextWorldUpdateTasks.Enqueue(std::forward<decltype(task)>(task), priority);
 }
 
 void ServerManager::OnPrecacheResources(IEntityResourceManifest* pResourceManifest)
@@ -21,6 +21,7 @@
 #include "scripting/script_engine.h"
 #include <concurrentqueue.h>
 
+#include "core/frame_task_queue.h"
 #include "core/game_system.h"
 
 namespace counterstrikesharp {
@@ -35,7 +36,8 @@ class ServerManager : public GlobalClass
     void OnShutdown() override;
     void* GetEconItemSystem();
     bool IsPaused();
-    void AddTaskForNextWorldUpdate(std::function<void()>&& task);
+    void AddTaskForNextWorldUpdate(std::function<void()>&& task, TaskPriority priority = TaskPriority::Normal);
+    FrameTaskQueue& GetNextWorldUpdateTasks() { return m_nextWorldUpdateTasks; }
     void OnPrecacheResources(IEntityResourceManifest* pResourceManifest);
 
   private:
@@ -57,7 +59,7 @@ class ServerManager : public GlobalClass
 
     ScriptCallback* on_server_precache_resources;
 
-    moodycamel::ConcurrentQueue<std::function<void()>> m_nextWorldUpdateTasks;
+    FrameTaskQueue m_nextWorldUpdateTasks;
 };
 
 } // namespace counterstrikesharp
@@ -62,7 +62,8 @@ SH_DECL_HOOK8_void(IGameEventSystem,
     {
         UserMessageHook* pHook;
 
-        CSSHARP_CORE_TRACE("Hooking user message: {0} with callback pointer: {1}", messageId, (void*)fnCallback);
+        CSSHARP_CORE_TRACE_CATEGORY(TraceUserMessages, "Hooking user message: {0} with callback pointer: {1}", messageId,
+                                    (void*)fnCallback);
 
         auto search = m_hooksMap.find(messageId);
         // If hook struct is not found
@@ -150,7 +151,8 @@ SH_DECL_HOOK8_void(IGameEventSystem,
             }
         }
 
-        CSSHARP_CORE_TRACE("Unhooking user message: {0} with callback pointer: {1}", messageId, (void*)fnCallback);
+        CSSHARP_CORE_TRACE_CATEGORY(TraceUserMessages, "Unhooking user message: {0} with callback pointer: {1}", messageId,
+                                    (void*)fnCallback);
 
         return;
     }
@@ -173,7 +175,8 @@ SH_DECL_HOOK8_void(IGameEventSystem,
 
             if (pCallback)
             {
-                CSSHARP_CORE_TRACE("Pushing user message `{}` pointer: {}, post: {}", iMessageID, (void*)pEvent, false);
+                CSSHARP_CORE_TRACE_CATEGORY(TraceUserMessages, "Pushing user message `{}` pointer: {}, post: {}", iMessageID, (void*)pEvent,
+                                            false);
                 pCallback->Reset();
                 pCallback->ScriptContext().Push(&message);
 
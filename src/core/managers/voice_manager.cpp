@@ -16,6 +16,8 @@
 
 #include "core/managers/voice_manager.h"
 
+#include <algorithm>
+
 #include <entity2/entitysystem.h>
 #include <public/eiface.h>
 #include <schema.h>
@@ -27,7 +29,7 @@ SH_DECL_HOOK3(IVEngineServer2, SetClientListening, SH_NOATTRIB, 0, bool, CPlayer
 
 namespace counterstrikesharp {
 
-VoiceManager::VoiceManager() {}
+VoiceManager::VoiceManager() { std::fill(std::begin(m_teams), std::end(m_teams), -1); }
 
 VoiceManager::~VoiceManager() {}
 
@@ -41,62 +43,124 @@ void VoiceManager::OnShutdown()
     SH_REMOVE_HOOK(IVEngineServer2, SetClientListening, globals::engine, SH_MEMBER(this, &VoiceManager::SetClientListening), false);
 }
 
-bool VoiceManager::SetClientListening(CPlayerSlot iReceiver, CPlayerSlot iSender, bool bListen)
+void VoiceManager::MarkDirty(int iReceiver)
 {
-    auto pReceiver = globals::playerManager.GetPlayerBySlot(iReceiver.Get());
-    auto pSender = globals::playerManager.GetPlayerBySlot(iSender.Get());
+    if (iReceiver >= 0 && iReceiver < kMaxVoiceSlots) m_dirtyReceivers |= 1ull << iReceiver;
+}
+
+void VoiceManager::MarkAllDirty() { m_dirtyReceivers = ~0ull; }
+
+void VoiceManager::RefreshTeams()
+{
+    auto pGlobalVars = globals::getGlobalVars();
+    if (!pGlobalVars || pGlobalVars->tickcount == m_lastTeamRefreshTick) return;
+
+    m_lastTeamRefreshTick = pGlobalVars->tickcount;
 
-    if (pReceiver && pSender)
+    auto maxClients = std::min(globals::playerManager.MaxClients(), kMaxVoiceSlots);
+
+    // Team membership only matters to players with team voice flags, so skip the entity lookups otherwise.
+    bool bAnyTeamFlags = false;
+    for (int i = 0; i < maxClients && !bAnyTeamFlags; i++)
     {
-        auto listenOverride = pReceiver->GetListen(iSender);
-        auto senderFlags = pSender->GetVoiceFlags();
-        auto receiverFlags = pReceiver->GetVoiceFlags();
+        auto pPlayer = globals::playerManager.GetPlayerBySlot(i);
+        bAnyTeamFlags = pPlayer && (pPlayer->GetVoiceFlags() & (Speak_Team | Speak_ListenTeam));
+    }
 
-        if (pReceiver->m_selfMutes->Get(iSender.Get()))
-        {
-            RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening, (iReceiver, iSender, false));
-        }
+    if (!bAnyTeamFlags || !globals::entitySystem)
+    {
+        std::fill(std::begin(m_teams), std::end(m_teams), -1);
+        return;
+    }
 
-        if (senderFlags & Speak_Muted)
-        {
-            RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening, (iReceiver, iSender, false));
-        }
+    static auto classKey = hash_32_fnv1a_const("CBaseEntity");
+    static auto memberKey = hash_32_fnv1a_const("m_iTeamNum");
+    const static auto m_key = schema::GetOffset("CBaseEntity", classKey, "m_iTeamNum", memberKey);
 
-        if (listenOverride == Listen_Mute)
-        {
-            RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening, (iReceiver, iSender, false));
-        }
-        else if (listenOverride == Listen_Hear)
-        {
-            RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening, (iReceiver, iSender, true));
-        }
+    for (int i = 0; i < maxClients; i++)
+    {
+        auto controller = globals::entitySystem->GetEntityInstance(CEntityIndex(i + 1));
+        int team = controller ? static_cast<int>(*reinterpret_cast<std::add_pointer_t<unsigned int>>((uintptr_t)(controller) + m_key.offset)) : -1;
 
-        if ((senderFlags & Speak_All) || (receiverFlags & Speak_ListenAll))
+        if (team != m_teams[i])
         {
-            RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening, (iReceiver, iSender, true));
+            m_teams[i] = team;
+            MarkAllDirty();
         }
+    }
+}
 
-        if ((senderFlags & Speak_Team) || (receiverFlags & Speak_ListenTeam))
-        {
-            static auto classKey = hash_32_fnv1a_const("CBaseEntity");
-            static auto memberKey = hash_32_fnv1a_const("m_iTeamNum");
-            const static auto m_key = schema::GetOffset("CBaseEntity", classKey, "m_iTeamNum", memberKey);
+void VoiceManager::RebuildReceiver(int iReceiver)
+{
+    m_dirtyReceivers &= ~(1ull << iReceiver);
 
-            auto receiverController = globals::entitySystem->GetEntityInstance(CEntityIndex(iReceiver.Get() + 1));
-            auto senderController = globals::entitySystem->GetEntityInstance(CEntityIndex(iSender.Get() + 1));
+    uint64_t decided = 0;
+    uint64_t listen = 0;
 
-            if (receiverController && senderController)
-            {
-                auto receiverTeam = *reinterpret_cast<std::add_pointer_t<unsigned int>>((uintptr_t)(receiverController) + m_key.offset);
+    auto pReceiver = globals::playerManager.GetPlayerBySlot(iReceiver);
 
-                auto senderTeam = *reinterpret_cast<std::add_pointer_t<unsigned int>>((uintptr_t)(senderController) + m_key.offset);
+    if (pReceiver)
+    {
+        auto receiverFlags = pReceiver->GetVoiceFlags();
+
+        for (int iSender = 0; iSender < kMaxVoiceSlots; iSender++)
+        {
+            auto pSender = globals::playerManager.GetPlayerBySlot(iSender);
+            if (!pSender) continue;
 
-                RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening,
-                                            (iReceiver, iSender, receiverTeam == senderTeam));
+            auto bit = 1ull << iSender;
+            auto listenOverride = pReceiver->GetListen(CPlayerSlot(iSender));
+            auto senderFlags = pSender->GetVoiceFlags();
+
+            if (pReceiver->m_selfMutes->Get(iSender) || (senderFlags & Speak_Muted) || listenOverride == Listen_Mute)
+            {
+                decided |= bit;
+            }
+            else if (listenOverride == Listen_Hear || (senderFlags & Speak_All) || (receiverFlags & Speak_ListenAll))
+            {
+                decided |= bit;
+                listen |= bit;
+            }
+            else if ((senderFlags & Speak_Team) || (receiverFlags & Speak_ListenTeam))
+            {
+                if (m_teams[iReceiver] != -1 && m_teams[iSender] != -1)
+                {
+                    decided |= bit;
+                    if (m_teams[iReceiver] == m_teams[iSender]) listen |= bit;
+                }
             }
         }
     }
 
+    m_decidedMask[iReceiver] = decided;
+    m_listenMask[iReceiver] = listen;
+}
+
+bool VoiceManager::SetClientListening(CPlayerSlot iReceiver, CPlayerSlot iSender, bool bListen)
+{
+    auto receiver = iReceiver.Get();
+    auto sender = iSender.Get();
+
+    if (receiver < 0 || receiver >= kMaxVoiceSlots || sender < 0 || sender >= kMaxVoiceSlots)
+    {
+        RETURN_META_VALUE(MRES_IGNORED, bListen);
+    }
+
+    RefreshTeams();
+
+    if (m_dirtyReceivers & (1ull << receiver))
+    {
+        RebuildReceiver(receiver);
+    }
+
+    auto bit = 1ull << sender;
+
+    if (m_decidedMask[receiver] & bit)
+    {
+        RETURN_META_VALUE_NEWPARAMS(MRES_IGNORED, bListen, &IVEngineServer2::SetClientListening,
+                                    (iReceiver, iSender, (m_listenMask[receiver] & bit) != 0));
+    }
+
     RETURN_META_VALUE(MRES_IGNORED, bListen);
 }
 
@@ -114,6 +178,7 @@ void VoiceManager::OnClientCommand(CPlayerSlot slot, const CCommand& args)
         sscanf(args.Arg(1), "%x", &mask);
 
         pPlayer->m_selfMutes->SetDWord(0, mask);
+        MarkDirty(slot.Get());
         //}
     }
 }
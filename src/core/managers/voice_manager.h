@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "core/globals.h"
 #include "core/global_listener.h"
 #include "scripting/script_engine.h"
@@ -33,7 +35,25 @@ class VoiceManager : public GlobalClass
     bool SetClientListening(CPlayerSlot iReceiver, CPlayerSlot iSender, bool bListen);
     void OnClientCommand(CPlayerSlot slot, const CCommand& args);
 
+    // Call whenever a receiver's overrides or self mutes change.
+    void MarkDirty(int iReceiver);
+    // Call whenever anything that affects every receiver changes, e.g. a sender's voice flags.
+    void MarkAllDirty();
+
   private:
+    static constexpr int kMaxVoiceSlots = 64;
+
+    void RefreshTeams();
+    void RebuildReceiver(int iReceiver);
+
+    // For each receiver, bit N of m_decidedMask says whether we override the engine's decision for
+    // sender N, and bit N of m_listenMask is the value we override it with.
+    uint64_t m_decidedMask[kMaxVoiceSlots] = {};
+    uint64_t m_listenMask[kMaxVoiceSlots] = {};
+    uint64_t m_dirtyReceivers = ~0ull;
+
+    int m_teams[kMaxVoiceSlots];
+    int m_lastTeamRefreshTick = -1;
 };
 
 } // namespace counterstrikesharp
@@ -0,0 +1,55 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace counterstrikesharp {
+
+/**
+ * Read-only, shared mapping of a file on disk.
+ *
+ * Pages come from the page cache and are shared with every other process mapping the same file, so large binaries can
+ * be inspected without copying them onto the heap.
+ */
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    [[nodiscard]] const std::uint8_t* Data() const { return m_data; }
+    [[nodiscard]] std::size_t Size() const { return m_size; }
+    [[nodiscard]] bool IsOpen() const { return m_data != nullptr; }
+
+  private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+#ifdef _WIN32
+    void* m_mapping = nullptr;
+#endif
+};
+
+} // namespace counterstrikesharp
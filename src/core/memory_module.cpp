@@ -1,11 +1,15 @@
 #include "core/memory_module.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <memory>
 #include <string_view>
+#include <thread>
 
 #include "core/globals.h"
 #include "platform.h"
@@ -20,15 +24,78 @@
 
 #include "core/gameconfig.h"
 #include "core/memory.h"
+#include "core/signature_scanner.h"
 #include "dbg.h"
 #include "log.h"
 #include "metamod_oslink.h"
 
 namespace counterstrikesharp::modules {
+namespace {
+struct PendingModule
+{
+    std::string name;
+#ifdef _WIN32
+    std::uintptr_t base{};
+#else
+    // dlpi_phdr points into the loaded image, so the copy stays valid after dl_iterate_phdr returns.
+    dl_phdr_info info{};
+#endif
+    std::unique_ptr<CModule> module;
+    double milliseconds{};
+};
+
+std::vector<int16_t> DecodeSignature(const std::string& signature)
+{
+    // Gamedata signatures are decoded once when the gamedata is loaded.
+    if (globals::gameConfig)
+    {
+        if (const auto pattern = globals::gameConfig->GetSignaturePattern(signature)) return *pattern;
+    }
+
+    return CGameConfig::HexToByte(signature);
+}
+
+// Module construction maps files and reads headers independently per module, so it is spread over a few threads.
+void ConstructModules(std::vector<PendingModule>& pending)
+{
+    std::atomic<std::size_t> next{ 0 };
+    auto worker = [&]() {
+        for (auto i = next++; i < pending.size(); i = next++)
+        {
+            auto& entry = pending[i];
+            const auto start = std::chrono::steady_clock::now();
+#ifdef _WIN32
+            entry.module = std::make_unique<CModule>(entry.name, entry.base);
+#else
+            entry.module = std::make_unique<CModule>(entry.name, &entry.info);
+#endif
+            entry.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    const auto threadCount = std::min<std::size_t>({ std::max(std::thread::hardware_concurrency(), 1u), 4, pending.size() });
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+} // namespace
+
 void Initialize()
 {
     if (!moduleList.empty()) return;
 
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<PendingModule> pending;
+
 #ifdef _WIN32
     // walk through peb to get modules
     const auto pteb = reinterpret_cast<PTEB>(__readgsqword(reinterpret_cast<DWORD_PTR>(&static_cast<NT_TIB*>(nullptr)->Self)));
@@ -56,14 +123,12 @@ void Initialize()
         bool isFromGameBin = name.find(GAMEBIN) != std::string::npos;
         if (!isFromGameBin && !isFromRootBin) continue;
 
-        auto mod = std::make_unique<CModule>(name, reinterpret_cast<std::uintptr_t>(module_entry->DllBase));
-        // it will delete itself after going out of scope
-        if (!mod->IsInitialized()) continue;
-
-        moduleList.emplace_back(std::move(mod));
+        auto& entry = pending.emplace_back();
+        entry.name = std::move(name);
+        entry.base = reinterpret_cast<std::uintptr_t>(module_entry->DllBase);
     }
 #else
-    dl_iterate_phdr([](struct dl_phdr_info* info, size_t, void*) {
+    dl_iterate_phdr([](struct dl_phdr_info* info, size_t, void* data) {
         std::string name = info->dlpi_name;
 
         if (name.rfind(MODULE_EXT) != name.length() - strlen(MODULE_EXT)) return 0;
@@ -74,13 +139,33 @@ void Initialize()
         bool isFromGameBin = name.find(GAMEBIN) != std::string::npos;
         if (!isFromGameBin && !isFromRootBin) return 0;
 
-        auto mod = std::make_unique<CModule>(name, info);
-        if (!mod->IsInitialized()) return 0;
-
-        moduleList.emplace_back(std::move(mod));
+        auto& entry = static_cast<std::vector<PendingModule>*>(data)->emplace_back();
+        entry.name = std::move(name);
+        entry.info = *info;
         return 0;
-    }, nullptr);
+    }, &pending);
 #endif
+
+    ConstructModules(pending);
+
+    for (auto& entry : pending)
+    {
+        CSSHARP_CORE_TRACE("Loaded module {} in {:.1f}ms", entry.name, entry.milliseconds);
+
+        // modules without CreateInterface are dropped here
+        if (!entry.module->IsInitialized()) continue;
+
+        moduleList.emplace_back(std::move(entry.module));
+    }
+
+    std::sort(pending.begin(), pending.end(), [](const PendingModule& a, const PendingModule& b) { return a.milliseconds > b.milliseconds; });
+
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    CSSHARP_CORE_INFO("Loaded {} modules in {:.1f}ms", moduleList.size(), elapsed);
+    for (std::size_t i = 0; i < std::min<std::size_t>(pending.size(), 3); i++)
+    {
+        CSSHARP_CORE_INFO("  {} took {:.1f}ms", pending[i].name, pending[i].milliseconds);
+    }
 }
 
 CModule* GetModuleByName(std::string name)
@@ -110,6 +195,37 @@ constexpr std::array modules_to_read_from_disk = {
     MODULE_PREFIX "server" MODULE_EXT,
 };
 
+#ifndef _WIN32
+namespace {
+std::string ReadBuildId(const std::uint8_t* notes, std::size_t size)
+{
+    std::size_t offset = 0;
+    while (offset + sizeof(ElfW(Nhdr)) <= size)
+    {
+        auto header = reinterpret_cast<const ElfW(Nhdr)*>(notes + offset);
+        const auto nameOffset = offset + sizeof(ElfW(Nhdr));
+        const auto descOffset = nameOffset + ((header->n_namesz + 3) & ~3u);
+        const auto nextOffset = descOffset + ((header->n_descsz + 3) & ~3u);
+        if (nextOffset > size) break;
+
+        if (header->n_type == NT_GNU_BUILD_ID && header->n_namesz == 4 && memcmp(notes + nameOffset, "GNU", 4) == 0)
+        {
+            std::string buildId = "elf-";
+            for (std::size_t i = 0; i < header->n_descsz; i++)
+            {
+                buildId += fmt::format("{:02x}", notes[descOffset + i]);
+            }
+            return buildId;
+        }
+
+        offset = nextOffset;
+    }
+
+    return {};
+}
+} // namespace
+#endif
+
 #ifdef _WIN32
 CModule::CModule(std::string_view path, std::uint64_t base)
 {
@@ -130,22 +246,16 @@ CModule::CModule(std::string_view path, std::uint64_t base)
     m_pszPath = path;
     m_baseAddress = base;
     m_size = nt_header->OptionalHeader.SizeOfImage;
+    m_moduleId = fmt::format("pe-{:08x}-{:x}", nt_header->FileHeader.TimeDateStamp, nt_header->OptionalHeader.SizeOfImage);
 
     const bool should_read_from_disk = std::any_of(modules_to_read_from_disk.begin(), modules_to_read_from_disk.end(), [&](const auto& i) {
         return m_pszModule == i;
     });
 
-    std::vector<std::uint8_t> disk_data{};
-    if (should_read_from_disk)
+    if (should_read_from_disk && !m_diskImage.Open(m_pszPath))
     {
-        std::ifstream stream(m_pszPath, std::ios::in | std::ios::binary);
-        if (!stream.good())
-        {
-            CSSHARP_CORE_ERROR("Cannot open file {}", m_pszPath);
-            return;
-        }
-        disk_data.reserve(std::filesystem::file_size(m_pszPath));
-        disk_data.assign((std::istreambuf_iterator(stream)), std::istreambuf_iterator<char>());
+        CSSHARP_CORE_ERROR("Cannot open file {}", m_pszPath);
+        return;
     }
 
     auto section = IMAGE_FIRST_SECTION(nt_header);
@@ -164,25 +274,23 @@ CModule::CModule(std::string_view path, std::uint64_t base)
             auto& segment = m_vecSegments.emplace_back();
 
             segment.address = start;
-            segment.bytes.reserve(size);
+            segment.size = size;
+            segment.data = data;
 
             if (should_read_from_disk)
             {
-                if (auto bytes = GetOriginalBytes(disk_data, start - m_baseAddress, size))
+                segment.data = GetOriginalBytes(section->PointerToRawData, size);
+                if (segment.data == nullptr)
                 {
-                    CSSHARP_CORE_INFO("Copying bytes from disk for {}", m_pszPath);
-                    segment.bytes = bytes.value();
-                    continue;
+                    CSSHARP_CORE_ERROR("Cannot get original bytes for {}", m_pszPath);
+                    return;
                 }
-                CSSHARP_CORE_ERROR("Cannot get original bytes for {}", m_pszPath);
-                return;
             }
-
-            segment.bytes.assign(&data[0], &data[size]);
         }
     }
 
-    DumpSymbols();
+    ReadSymbolTables();
+    m_fnCreateInterface = reinterpret_cast<fnCreateInterface>(LookupSymbol("CreateInterface"));
 
     if (m_fnCreateInterface == nullptr) return;
 
@@ -199,17 +307,10 @@ CModule::CModule(std::string_view path, dl_phdr_info* info)
         return m_pszModule == i;
     });
 
-    std::vector<std::uint8_t> disk_data{};
-    if (should_read_from_disk)
+    if (should_read_from_disk && !m_diskImage.Open(m_pszPath))
     {
-        std::ifstream stream(m_pszPath, std::ios::in | std::ios::binary);
-        if (!stream.good())
-        {
-            CSSHARP_CORE_ERROR("Cannot open file {}", m_pszPath);
-            return;
-        }
-        disk_data.reserve(std::filesystem::file_size(m_pszPath));
-        disk_data.assign((std::istreambuf_iterator(stream)), std::istreambuf_iterator<char>());
+        CSSHARP_CORE_ERROR("Cannot open file {}", m_pszPath);
+        return;
     }
 
     for (auto i = 0; i < info->dlpi_phnum; i++)
@@ -219,7 +320,13 @@ CModule::CModule(std::string_view path, dl_phdr_info* info)
         auto is_dynamic_section = type == PT_DYNAMIC;
         if (is_dynamic_section)
         {
-            DumpSymbols(reinterpret_cast<ElfW(Dyn)*>(address));
+            ReadSymbolTables(reinterpret_cast<ElfW(Dyn)*>(address));
+            continue;
+        }
+
+        if (type == PT_NOTE && m_moduleId.empty())
+        {
+            m_moduleId = ReadBuildId(reinterpret_cast<const std::uint8_t*>(address), info->dlpi_phdr[i].p_memsz);
             continue;
         }
 
@@ -233,28 +340,26 @@ CModule::CModule(std::string_view path, dl_phdr_info* info)
         if (!is_executable || !is_readable) continue;
 
         auto size = info->dlpi_phdr[i].p_filesz;
-        auto* data = reinterpret_cast<std::uint8_t*>(address);
+        auto* data = reinterpret_cast<const std::uint8_t*>(address);
 
         auto& segment = m_vecSegments.emplace_back();
 
         segment.address = address;
-        segment.bytes.reserve(size);
+        segment.size = size;
+        segment.data = data;
 
         if (should_read_from_disk)
         {
-            if (auto bytes = GetOriginalBytes(disk_data, address - m_baseAddress, size))
+            segment.data = GetOriginalBytes(info->dlpi_phdr[i].p_offset, size);
+            if (segment.data == nullptr)
             {
-                CSSHARP_CORE_INFO("Copying bytes from disk for {}", m_pszPath);
-                segment.bytes = bytes.value();
-                continue;
+                CSSHARP_CORE_ERROR("Cannot get original bytes for {}", m_pszPath);
+                return;
             }
-            CSSHARP_CORE_ERROR("Cannot get original bytes for {}", m_pszPath);
-            return;
         }
-
-        segment.bytes.assign(&data[0], &data[size]);
     }
 
+    m_fnCreateInterface = reinterpret_cast<fnCreateInterface>(LookupSymbol("CreateInterface"));
     if (m_fnCreateInterface == nullptr) return;
 
     m_bInitialized = true;
@@ -262,7 +367,7 @@ CModule::CModule(std::string_view path, dl_phdr_info* info)
 #endif
 
 #ifdef _WIN32
-void CModule::DumpSymbols()
+void CModule::ReadSymbolTables()
 {
     const auto dos_header = reinterpret_cast<PIMAGE_DOS_HEADER>(m_baseAddress);
 
@@ -271,219 +376,265 @@ void CModule::DumpSymbols()
     const auto [export_address_rva, export_size] = nt_header->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
     if (export_size == 0 || export_address_rva == 0) return;
 
-    auto export_directory = reinterpret_cast<IMAGE_EXPORT_DIRECTORY*>(m_baseAddress + export_address_rva);
-    const auto names = reinterpret_cast<uint32_t*>(m_baseAddress + export_directory->AddressOfNames);
-    const auto addresses = reinterpret_cast<uint32_t*>(m_baseAddress + export_directory->AddressOfFunctions);
-    const auto ordinals = reinterpret_cast<std::uint16_t*>(m_baseAddress + export_directory->AddressOfNameOrdinals);
+    m_exportDirectory = m_baseAddress + export_address_rva;
+    m_exportSize = export_size;
+}
 
-    for (auto i = 0ull; i < export_directory->NumberOfNames; i++)
-    {
-        const auto export_name = reinterpret_cast<const char*>(m_baseAddress + names[i]);
-        const auto address = m_baseAddress + addresses[ordinals[i]];
+std::uintptr_t CModule::LookupSymbol(std::string_view name) const
+{
+    if (!m_exportDirectory) return 0;
 
-        if (address >= reinterpret_cast<uintptr_t>(export_directory) &&
-            address < reinterpret_cast<uintptr_t>(export_directory) + export_size)
-            continue;
+    const auto export_directory = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY*>(m_exportDirectory);
+    const auto names = reinterpret_cast<const uint32_t*>(m_baseAddress + export_directory->AddressOfNames);
+    const auto addresses = reinterpret_cast<const uint32_t*>(m_baseAddress + export_directory->AddressOfFunctions);
+    const auto ordinals = reinterpret_cast<const std::uint16_t*>(m_baseAddress + export_directory->AddressOfNameOrdinals);
 
-        if (std::string_view(export_name) == "CreateInterface")
-        {
-            m_fnCreateInterface = reinterpret_cast<fnCreateInterface>(address);
-        }
+    // The export name table is sorted, so a binary search finds the name without touching every export.
+    const auto nameCount = static_cast<std::size_t>(export_directory->NumberOfNames);
+    const auto it = std::lower_bound(names, names + nameCount, name, [this](uint32_t nameRva, std::string_view value) {
+        return std::string_view(reinterpret_cast<const char*>(m_baseAddress + nameRva)) < value;
+    });
+    if (it == names + nameCount || std::string_view(reinterpret_cast<const char*>(m_baseAddress + *it)) != name) return 0;
 
-        _symbols[export_name] = address;
-    }
+    const auto address = m_baseAddress + addresses[ordinals[it - names]];
+
+    // Forwarded exports point back into the export directory at the name of the real export.
+    if (address >= m_exportDirectory && address < m_exportDirectory + m_exportSize) return 0;
+
+    return address;
 }
 #else
-void CModule::DumpSymbols(ElfW(Dyn) * dyn)
+void CModule::ReadSymbolTables(ElfW(Dyn) * dyn)
 {
-    // thanks to https://stackoverflow.com/a/57099317
-    auto GetNumberOfSymbolsFromGnuHash = [](ElfW(Addr) gnuHashAddress) {
-        // See https://flapenguin.me/2017/05/10/elf-lookup-dt-gnu-hash/ and
-        // https://sourceware.org/ml/binutils/2006-10/msg00377.html
-        struct Header
+    for (; dyn->d_tag != DT_NULL; dyn++)
+    {
+        switch (dyn->d_tag)
         {
-            uint32_t nbuckets;
-            uint32_t symoffset;
-            uint32_t bloom_size;
-            uint32_t bloom_shift;
-        };
+            case DT_HASH:
+                m_hashTable = reinterpret_cast<const ElfW(Word)*>(dyn->d_un.d_ptr);
+                break;
+            case DT_GNU_HASH:
+                m_gnuHashTable = reinterpret_cast<const std::uint32_t*>(dyn->d_un.d_ptr);
+                break;
+            case DT_STRTAB:
+                m_stringTable = reinterpret_cast<const char*>(dyn->d_un.d_ptr);
+                break;
+            case DT_SYMTAB:
+                m_symbolTable = reinterpret_cast<const ElfW(Sym)*>(dyn->d_un.d_ptr);
+                break;
+            default:
+                break;
+        }
+    }
+}
 
-        auto header = (Header*)gnuHashAddress;
-        const auto bucketsAddress = gnuHashAddress + sizeof(Header) + (sizeof(std::uintptr_t) * header->bloom_size);
+std::uintptr_t CModule::LookupSymbol(std::string_view name) const
+{
+    if (!m_symbolTable || !m_stringTable) return 0;
 
-        // Locate the chain that handles the largest index bucket.
-        uint32_t lastSymbol = 0;
-        auto bucketAddress = (uint32_t*)bucketsAddress;
-        for (uint32_t i = 0; i < header->nbuckets; ++i)
-        {
-            uint32_t bucket = *bucketAddress;
-            if (lastSymbol < bucket)
-            {
-                lastSymbol = bucket;
-            }
-            bucketAddress++;
-        }
+    auto isMatch = [&](ElfW(Word) index) {
+        const auto& symbol = m_symbolTable[index];
+        return symbol.st_name && symbol.st_other == 0 && symbol.st_shndx != SHN_UNDEF && name == &m_stringTable[symbol.st_name];
+    };
 
-        if (lastSymbol < header->symoffset)
+    // See https://flapenguin.me/elf-lookup-dt-gnu-hash for the layout of both tables.
+    if (m_gnuHashTable)
+    {
+        const auto bucketCount = m_gnuHashTable[0];
+        const auto symbolOffset = m_gnuHashTable[1];
+        const auto bloomSize = m_gnuHashTable[2];
+        const auto bloomShift = m_gnuHashTable[3];
+        const auto bloom = reinterpret_cast<const ElfW(Addr)*>(&m_gnuHashTable[4]);
+        const auto buckets = reinterpret_cast<const std::uint32_t*>(&bloom[bloomSize]);
+        const auto chain = &buckets[bucketCount];
+
+        std::uint32_t hash = 5381;
+        for (const auto c : name)
         {
-            return header->symoffset;
+            hash = hash * 33 + static_cast<std::uint8_t>(c);
         }
 
-        // Walk the bucket's chain to add the chain length to the total.
-        const auto chainBaseAddress = bucketsAddress + (sizeof(uint32_t) * header->nbuckets);
-        for (;;)
-        {
-            auto chainEntry = (uint32_t*)(chainBaseAddress + (lastSymbol - header->symoffset) * sizeof(uint32_t));
-            lastSymbol++;
+        // Most misses are rejected by the bloom filter without touching the symbol table.
+        constexpr auto bloomBits = sizeof(ElfW(Addr)) * 8;
+        const auto word = bloom[(hash / bloomBits) % bloomSize];
+        const auto mask = (ElfW(Addr){ 1 } << (hash % bloomBits)) | (ElfW(Addr){ 1 } << ((hash >> bloomShift) % bloomBits));
+        if ((word & mask) != mask) return 0;
 
-            // If the low bit is set, this entry is the end of the chain.
-            if (*chainEntry & 1)
-            {
-                break;
-            }
-        }
-
-        return lastSymbol;
-    };
+        auto index = buckets[hash % bucketCount];
+        if (index < symbolOffset) return 0;
 
-    ElfW(Sym) * symbols{};
-    ElfW(Word) * hash_ptr{};
+        for (;; index++)
+        {
+            const auto chainHash = chain[index - symbolOffset];
+            if ((chainHash | 1) == (hash | 1) && isMatch(index)) return m_baseAddress + m_symbolTable[index].st_value;
+            if (chainHash & 1) break;
+        }
 
-    char* string_table{};
-    std::size_t symbol_count{};
+        return 0;
+    }
 
-    while (dyn->d_tag != DT_NULL)
+    if (m_hashTable)
     {
-        if (dyn->d_tag == DT_HASH)
-        {
-            hash_ptr = reinterpret_cast<ElfW(Word)*>(dyn->d_un.d_ptr);
-            symbol_count = hash_ptr[1];
-        }
-        else if (dyn->d_tag == DT_STRTAB)
+        const auto bucketCount = m_hashTable[0];
+        const auto buckets = &m_hashTable[2];
+        const auto chain = &buckets[bucketCount];
+
+        ElfW(Word) hash = 0;
+        for (const auto c : name)
         {
-            string_table = reinterpret_cast<char*>(dyn->d_un.d_ptr);
+            hash = (hash << 4) + static_cast<std::uint8_t>(c);
+            const auto high = hash & 0xf0000000;
+            if (high) hash ^= high >> 24;
+            hash &= ~high;
         }
-        else if (!symbol_count && dyn->d_tag == DT_GNU_HASH)
+
+        for (auto index = buckets[hash % bucketCount]; index != STN_UNDEF; index = chain[index])
         {
-            symbol_count = GetNumberOfSymbolsFromGnuHash(dyn->d_un.d_ptr);
+            if (isMatch(index)) return m_baseAddress + m_symbolTable[index].st_value;
         }
-        else if (dyn->d_tag == DT_SYMTAB)
-        {
-            symbols = reinterpret_cast<ElfW(Sym)*>(dyn->d_un.d_ptr);
+    }
 
-            for (auto i = 0; i < symbol_count; i++)
-            {
-                if (!symbols[i].st_name)
-                {
-                    continue;
-                }
+    return 0;
+}
+#endif
 
-                if (symbols[i].st_other != 0)
-                {
-                    continue;
-                }
+const std::uint8_t* CModule::GetOriginalBytes(std::uintptr_t fileOffset, std::size_t size) const
+{
+    if (!m_diskImage.IsOpen() || fileOffset > m_diskImage.Size() || size > m_diskImage.Size() - fileOffset) return nullptr;
 
-                auto address = symbols[i].st_value + m_baseAddress;
-                std::string_view name = &string_table[symbols[i].st_name];
+    return m_diskImage.Data() + fileOffset;
+}
 
-                if (name == "CreateInterface")
-                {
-                    m_fnCreateInterface = reinterpret_cast<fnCreateInterface>(address);
-                }
+void* CModule::FindSignature(const char* signature)
+{
+    if (signature == nullptr || strlen(signature) == 0)
+    {
+        return nullptr;
+    }
 
-                _symbols.insert({ name.data(), address });
-            }
-        }
+    if (const auto it = m_signatureCache.find(signature); it != m_signatureCache.end())
+    {
+        return it->second;
+    }
 
-        dyn++;
+    auto pData = DecodeSignature(signature);
+    if (pData.empty()) [[unlikely]]
+    {
+        CSSHARP_CORE_ERROR("Cannot convert signture \"{}\" to bytes", signature);
+        return nullptr;
     }
+
+    auto address = this->FindSignature(pData);
+    m_signatureCache.emplace(signature, address);
+
+    return address;
 }
-#endif
 
-std::optional<std::vector<std::uint8_t>>
-CModule::GetOriginalBytes(const std::vector<std::uint8_t>& disk_data, std::uintptr_t rva, std::size_t size)
+std::vector<void*> CModule::FindSignatures(const std::vector<std::string>& signatures)
 {
-    auto get_file_ptr_from_rva = [](std::uint8_t* data, std::uintptr_t address) -> std::optional<std::uintptr_t> {
-#ifdef _WIN32
-        // thank you praydog
-        // https://github.com/cursey/kananlib/blob/b0323a0b005fc9e3944e0ea36dcc98eda4b84eea/src/Module.cpp#L176
+    std::vector<void*> addresses(signatures.size(), nullptr);
 
-        const auto dos_header = reinterpret_cast<PIMAGE_DOS_HEADER>(data);
-        const auto nt_header = reinterpret_cast<PIMAGE_NT_HEADERS>(&data[dos_header->e_lfanew]);
-        auto section = IMAGE_FIRST_SECTION(nt_header);
-        for (auto i = 0; i < nt_header->FileHeader.NumberOfSections; i++, section++)
+    std::vector<SignaturePattern> patterns;
+    std::vector<size_t> patternSignatures;
+    patterns.reserve(signatures.size());
+
+    for (size_t i = 0; i < signatures.size(); i++)
+    {
+        if (const auto it = m_signatureCache.find(signatures[i]); it != m_signatureCache.end())
         {
-            auto section_size = section->Misc.VirtualSize;
-            if (section_size == 0)
-            {
-                section_size = section->SizeOfRawData;
-            }
+            addresses[i] = it->second;
+            continue;
+        }
 
-            if (address >= section->VirtualAddress && address < static_cast<uintptr_t>(section->VirtualAddress) + section_size)
-            {
-                const auto delta = section->VirtualAddress - section->PointerToRawData;
+        auto bytes = DecodeSignature(signatures[i]);
+        if (bytes.empty())
+        {
+            CSSHARP_CORE_ERROR("Cannot convert signture \"{}\" to bytes", signatures[i]);
+            continue;
+        }
 
-                return reinterpret_cast<std::uintptr_t>(data + (address - delta));
-            }
+        patterns.emplace_back(std::move(bytes));
+        patternSignatures.push_back(i);
+    }
+
+    std::vector<const SignaturePattern*> patternPtrs;
+    patternPtrs.reserve(patterns.size());
+    for (auto& pattern : patterns)
+    {
+        patternPtrs.push_back(&pattern);
+    }
+
+    std::vector<size_t> found(patterns.size(), SignaturePattern::npos);
+
+    for (auto&& segment : m_vecSegments)
+    {
+        std::vector<size_t> offsets(found.size(), SignaturePattern::npos);
+        for (size_t i = 0; i < found.size(); i++)
+        {
+            // Matches from earlier segments win, same as FindSignature.
+            if (found[i] != SignaturePattern::npos) offsets[i] = 0;
         }
-        return std::nullopt;
-#else
-        // on linux you can just read from rva
-        return reinterpret_cast<std::uintptr_t>(data + address);
-#endif
-    };
 
-    const auto disk_ptr = get_file_ptr_from_rva(const_cast<std::uint8_t*>(disk_data.data()), rva);
-    if (!disk_ptr) return std::nullopt;
+        ScanForPatterns(segment.data, segment.size, patternPtrs, offsets);
+
+        for (size_t i = 0; i < found.size(); i++)
+        {
+            if (found[i] != SignaturePattern::npos || offsets[i] == SignaturePattern::npos) continue;
+
+            found[i] = offsets[i];
+            addresses[patternSignatures[i]] = reinterpret_cast<void*>(segment.address + offsets[i]);
+        }
+    }
 
-    const auto disk_bytes = reinterpret_cast<std::uint8_t*>(*disk_ptr);
-    std::vector<std::uint8_t> result{ &disk_bytes[0], &disk_bytes[size] };
+    for (size_t i = 0; i < patternSignatures.size(); i++)
+    {
+        const auto index = patternSignatures[i];
+        m_signatureCache.emplace(signatures[index], addresses[index]);
+    }
 
-    return result;
+    return addresses;
 }
 
-void* CModule::FindSignature(const char* signature)
+bool CModule::IsSignatureAt(std::uintptr_t address, const char* signature) const
 {
-    if (signature == nullptr || strlen(signature) == 0)
+    const auto bytes = DecodeSignature(signature);
+    if (bytes.empty()) return false;
+
+    const SignaturePattern pattern(bytes);
+
+    for (auto&& segment : m_vecSegments)
     {
-        return nullptr;
+        if (address < segment.address || address - segment.address + bytes.size() > segment.size) continue;
+
+        return pattern.Matches(segment.data + (address - segment.address));
     }
 
-    auto pData = CGameConfig::HexToByte(signature);
-    if (pData.empty()) [[unlikely]]
+    return false;
+}
+
+const std::string& CModule::GetModuleId()
+{
+    if (m_moduleId.empty())
     {
-        CSSHARP_CORE_ERROR("Cannot convert signture \"{}\" to bytes", signature);
-        return nullptr;
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(m_pszPath, ec);
+        const auto modified = std::filesystem::last_write_time(m_pszPath, ec).time_since_epoch().count();
+        m_moduleId = fmt::format("file-{:x}-{:x}", size, modified);
     }
 
-    return this->FindSignature(pData);
+    return m_moduleId;
 }
 
 void* CModule::FindSignature(const std::vector<int16_t>& sigBytes)
 {
+    const SignaturePattern pattern(sigBytes);
+
     for (auto&& segment : m_vecSegments)
     {
-        const auto size = segment.bytes.size();
-        auto* data = segment.bytes.data();
-
-        auto first_byte = sigBytes[0];
-        std::uint8_t* end = data + size - sigBytes.size();
-
-        for (std::uint8_t* current = data; current <= end; ++current)
+        const auto offset = ScanForPattern(segment.data, segment.size, pattern);
+        if (offset != SignaturePattern::npos)
         {
-            if (first_byte != -1) current = std::find(current, end, first_byte);
-
-            if (current == end)
-            {
-                break;
-            }
-
-            if (std::equal(sigBytes.begin() + 1, sigBytes.end(), current + 1, [](auto opt, auto byte) {
-                return opt == -1 || opt == byte;
-            }))
-            {
-                return reinterpret_cast<void*>(current - data + segment.address);
-            }
+            return reinterpret_cast<void*>(segment.address + offset);
         }
     }
 
@@ -552,12 +703,18 @@ void* CModule::FindInterface(std::string_view name)
 
 void* CModule::FindSymbol(const std::string& name)
 {
-    if (const auto it = _symbols.find(name); it != _symbols.end())
+    auto it = m_symbolCache.find(name);
+    if (it == m_symbolCache.end())
     {
-        return reinterpret_cast<void*>(it->second);
+        it = m_symbolCache.emplace(name, LookupSymbol(name)).first;
     }
 
-    CSSHARP_CORE_ERROR("Cannot find symbol {}", name);
-    return nullptr;
+    if (it->second == 0)
+    {
+        CSSHARP_CORE_ERROR("Cannot find symbol {}", name);
+        return nullptr;
+    }
+
+    return reinterpret_cast<void*>(it->second);
 }
 } // namespace counterstrikesharp::modules
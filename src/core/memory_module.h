@@ -30,6 +30,7 @@
 #include <link.h>
 #endif
 
+#include "core/mapped_file.h"
 #include "interface.h"
 #include "strtools.h"
 #undef snprintf
@@ -46,7 +47,9 @@ struct Segments
     Segments& operator=(Segments&&) = default;
 
     std::uintptr_t address{};
-    std::vector<std::uint8_t> bytes{};
+    // View of the segment's bytes, either the loaded module itself or the module's mapped file on disk.
+    const std::uint8_t* data{};
+    std::size_t size{};
 };
 
 class CModule
@@ -60,6 +63,19 @@ class CModule
 
     void* FindSignature(const char* signature);
 
+    // Resolves every signature in a single pass over the module. Results are remembered, so later FindSignature
+    // calls for the same signatures don't scan again.
+    std::vector<void*> FindSignatures(const std::vector<std::string>& signatures);
+
+    // Whether the module's original bytes at address match the signature, used to validate cached results.
+    bool IsSignatureAt(std::uintptr_t address, const char* signature) const;
+    void SeedSignature(const std::string& signature, void* address) { m_signatureCache.emplace(signature, address); }
+
+    // Identifies this exact build of the module: the ELF build-id on Linux, or the PE timestamp and image size on
+    // Windows. Falls back to the file size and modification time.
+    const std::string& GetModuleId();
+    [[nodiscard]] std::uintptr_t GetBaseAddress() const { return m_baseAddress; }
+
     void* FindInterface(std::string_view name);
 
     void* FindSymbol(const std::string& name);
@@ -74,20 +90,34 @@ class CModule
   private:
     bool m_bInitialized{};
     std::vector<Segments> m_vecSegments{};
+    MappedFile m_diskImage{};
     std::uintptr_t m_baseAddress{};
-    std::unordered_map<std::string, std::uintptr_t> _symbols{};
+    // Symbols looked up so far, including misses (0). Lookups go through the module's own hash tables.
+    std::unordered_map<std::string, std::uintptr_t> m_symbolCache{};
     std::unordered_map<std::string, std::uintptr_t> _interfaces{};
+    std::unordered_map<std::string, void*> m_signatureCache{};
+    std::string m_moduleId{};
     using fnCreateInterface = void* (*)(const char*);
     fnCreateInterface m_fnCreateInterface{};
 
 #ifdef _WIN32
-    void DumpSymbols();
+    std::uintptr_t m_exportDirectory{};
+    std::uint32_t m_exportSize{};
+
+    void ReadSymbolTables();
 #else
-    void DumpSymbols(ElfW(Dyn) * dyn);
+    const ElfW(Sym) * m_symbolTable{};
+    const char* m_stringTable{};
+    const ElfW(Word) * m_hashTable{};
+    const std::uint32_t* m_gnuHashTable{};
+
+    void ReadSymbolTables(ElfW(Dyn) * dyn);
 #endif
 
-    std::optional<std::vector<std::uint8_t>>
-    GetOriginalBytes(const std::vector<std::uint8_t>& disk_data, std::uintptr_t rva, std::size_t size);
+    std::uintptr_t LookupSymbol(std::string_view name) const;
+
+    // Points into the mapped file on disk, for modules whose loaded code is patched before we get to scan it.
+    const std::uint8_t* GetOriginalBytes(std::uintptr_t fileOffset, std::size_t size) const;
 
     void* FindSignature(const std::vector<int16_t>& sigBytes);
 };
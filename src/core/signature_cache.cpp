@@ -0,0 +1,129 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/signature_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include <nlohmann/json.hpp>
+
+#include "core/log.h"
+
+namespace counterstrikesharp {
+
+namespace {
+constexpr int kCacheVersion = 1;
+}
+
+SignatureCache::SignatureCache(std::string path) : m_path(std::move(path)) {}
+
+void SignatureCache::Load()
+{
+    std::ifstream ifs(m_path);
+    if (!ifs) return;
+
+    try
+    {
+        auto json = nlohmann::json::parse(ifs);
+        if (json.value("version", 0) != kCacheVersion) return;
+
+        for (auto& [moduleId, signatures] : json["modules"].items())
+        {
+            auto& entries = m_modules[moduleId];
+            for (auto& [signature, rva] : signatures.items())
+            {
+                entries[signature] = rva.get<std::uintptr_t>();
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        CSSHARP_CORE_WARN("Ignoring signature cache {}: {}", m_path, ex.what());
+        m_modules.clear();
+    }
+}
+
+void SignatureCache::Save()
+{
+    if (!m_dirty) return;
+
+    nlohmann::json json;
+    json["version"] = kCacheVersion;
+    auto& modules = json["modules"];
+    for (const auto& [moduleId, signatures] : m_modules)
+    {
+        if (!m_usedModules.contains(moduleId)) continue;
+
+        for (const auto& [signature, rva] : signatures)
+        {
+            modules[moduleId][signature] = rva;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(m_path).parent_path(), ec);
+
+    // Several server processes can share an install, so write to a private file next to the cache and swap it in
+    // atomically.
+    auto tempPath = m_path + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream ofs(tempPath, std::ios::trunc);
+        if (!ofs)
+        {
+            CSSHARP_CORE_WARN("Could not write signature cache {}", tempPath);
+            return;
+        }
+        ofs << json.dump();
+    }
+
+    std::filesystem::rename(tempPath, m_path, ec);
+    if (ec)
+    {
+        CSSHARP_CORE_WARN("Could not write signature cache {}: {}", m_path, ec.message());
+        std::filesystem::remove(tempPath, ec);
+        return;
+    }
+
+    m_dirty = false;
+}
+
+std::optional<std::uintptr_t> SignatureCache::Find(const std::string& moduleId, const std::string& signature)
+{
+    m_usedModules.insert(moduleId);
+
+    auto module = m_modules.find(moduleId);
+    if (module == m_modules.end()) return std::nullopt;
+
+    auto entry = module->second.find(signature);
+    if (entry == module->second.end()) return std::nullopt;
+
+    return entry->second;
+}
+
+void SignatureCache::Store(const std::string& moduleId, const std::string& signature, std::uintptr_t rva)
+{
+    m_usedModules.insert(moduleId);
+
+    auto& entry = m_modules[moduleId][signature];
+    if (entry == rva) return;
+
+    entry = rva;
+    m_dirty = true;
+}
+
+} // namespace counterstrikesharp
@@ -0,0 +1,52 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace counterstrikesharp {
+
+/**
+ * Signature scan results persisted between server starts.
+ *
+ * Entries are keyed by the module's build identity and the signature string, and store the address relative to the
+ * module base. Callers must re-check the bytes at a cached address before trusting it.
+ */
+class SignatureCache
+{
+  public:
+    explicit SignatureCache(std::string path);
+
+    void Load();
+    void Save();
+
+    std::optional<std::uintptr_t> Find(const std::string& moduleId, const std::string& signature);
+    void Store(const std::string& moduleId, const std::string& signature, std::uintptr_t rva);
+
+  private:
+    std::string m_path;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::uintptr_t>> m_modules;
+    // Modules looked up this run. Entries for any other build are dropped on save.
+    std::unordered_set<std::string> m_usedModules;
+    bool m_dirty = false;
+};
+
+} // namespace counterstrikesharp
@@ -0,0 +1,293 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/signature_scanner.h"
+
+#include <algorithm>
+#include <array>
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define CSSHARP_TARGET_SSSE3
+#else
+#include <cpuid.h>
+#define CSSHARP_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+namespace counterstrikesharp::modules {
+
+namespace {
+// Bytes that dominate x86-64 code, most frequent first: REX prefixes, mov/lea/call opcodes, ModRM and padding.
+constexpr std::array<uint8_t, 32> kCommonBytes = { 0x00, 0xFF, 0x48, 0x89, 0x8B, 0x0F, 0xE8, 0x24, 0x4C, 0x44, 0x85,
+                                                   0xC0, 0x74, 0x8D, 0x83, 0x41, 0x75, 0x01, 0xCC, 0x49, 0x45, 0x10,
+                                                   0x08, 0x90, 0xC3, 0x20, 0x18, 0xE9, 0xEB, 0x84, 0xC7, 0x66 };
+
+constexpr std::array<uint8_t, 256> BuildByteCosts()
+{
+    std::array<uint8_t, 256> costs{};
+    for (size_t i = 0; i < kCommonBytes.size(); i++)
+    {
+        costs[kCommonBytes[i]] = static_cast<uint8_t>(kCommonBytes.size() - i);
+    }
+    return costs;
+}
+
+constexpr auto kByteCosts = BuildByteCosts();
+
+inline unsigned CountTrailingZeros(unsigned value)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return index;
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+// The build only assumes SSE2, so the batch prefilter checks for SSSE3 (pshufb) at runtime.
+bool HasSsse3()
+{
+    unsigned info[4] = {};
+#ifdef _MSC_VER
+    __cpuid(reinterpret_cast<int*>(info), 1);
+#else
+    if (!__get_cpuid(1, &info[0], &info[1], &info[2], &info[3])) return false;
+#endif
+    return (info[2] & (1u << 9)) != 0;
+}
+
+// A set of byte values laid out for pshufb lookups: for each low nibble, one bit per high nibble, split in two halves.
+struct ByteSet
+{
+    alignas(16) uint8_t highNibbles0to7[16] = {};
+    alignas(16) uint8_t highNibbles8to15[16] = {};
+
+    void Add(uint8_t value)
+    {
+        auto& table = (value >> 4) < 8 ? highNibbles0to7 : highNibbles8to15;
+        table[value & 0x0F] |= static_cast<uint8_t>(1u << ((value >> 4) & 7));
+    }
+};
+
+// Returns 0xFF in each lane whose byte is in the set.
+CSSHARP_TARGET_SSSE3 inline __m128i ByteSetContains(__m128i values, __m128i lowTable, __m128i highTable)
+{
+    const auto nibbleMask = _mm_set1_epi8(0x0F);
+    const auto bitForNibble = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+    const auto lowNibbles = _mm_and_si128(values, nibbleMask);
+    const auto highNibbles = _mm_and_si128(_mm_srli_epi16(values, 4), nibbleMask);
+
+    const auto isLowHalf = _mm_cmplt_epi8(highNibbles, _mm_set1_epi8(8));
+    const auto rows = _mm_or_si128(_mm_and_si128(isLowHalf, _mm_shuffle_epi8(lowTable, lowNibbles)),
+                                   _mm_andnot_si128(isLowHalf, _mm_shuffle_epi8(highTable, lowNibbles)));
+    const auto bits = _mm_shuffle_epi8(bitForNibble, highNibbles);
+
+    return _mm_cmpeq_epi8(_mm_and_si128(rows, bits), bits);
+}
+
+// Calls visit(position) for every position whose byte is in firstBytes and whose next byte is in secondBytes, 16
+// positions at a time, until visit returns false. Returns the first position it did not test.
+template <typename Visit>
+CSSHARP_TARGET_SSSE3 size_t PrefilterAnchorPairs(const uint8_t* data, size_t size, const ByteSet& firstBytes, const ByteSet& secondBytes,
+                                                 Visit&& visit)
+{
+    const auto firstLow = _mm_load_si128(reinterpret_cast<const __m128i*>(firstBytes.highNibbles0to7));
+    const auto firstHigh = _mm_load_si128(reinterpret_cast<const __m128i*>(firstBytes.highNibbles8to15));
+    const auto secondLow = _mm_load_si128(reinterpret_cast<const __m128i*>(secondBytes.highNibbles0to7));
+    const auto secondHigh = _mm_load_si128(reinterpret_cast<const __m128i*>(secondBytes.highNibbles8to15));
+
+    size_t i = 0;
+    // The second load reads one byte further, so stop while a full 17 bytes remain.
+    for (; i + 17 <= size; i += 16)
+    {
+        const auto first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+        const auto hits = _mm_and_si128(ByteSetContains(first, firstLow, firstHigh), ByteSetContains(second, secondLow, secondHigh));
+
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        while (mask != 0)
+        {
+            if (!visit(i + CountTrailingZeros(mask))) return i + 16;
+            mask &= mask - 1;
+        }
+    }
+
+    return i;
+}
+} // namespace
+
+SignaturePattern::SignaturePattern(std::vector<int16_t> pattern) : bytes(std::move(pattern))
+{
+    unsigned bestCost = ~0u;
+
+    for (size_t i = 0; i + 1 < bytes.size(); i++)
+    {
+        if (bytes[i] == -1 || bytes[i + 1] == -1) continue;
+
+        unsigned cost = kByteCosts[bytes[i]] + kByteCosts[bytes[i + 1]];
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            anchorOffset = i;
+            anchorIsPair = true;
+        }
+    }
+
+    if (anchorIsPair) return;
+
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        if (bytes[i] == -1) continue;
+
+        if (anchorOffset == npos || kByteCosts[bytes[i]] < kByteCosts[bytes[anchorOffset]])
+        {
+            anchorOffset = i;
+        }
+    }
+}
+
+bool SignaturePattern::Matches(const uint8_t* data) const
+{
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        if (bytes[i] != -1 && bytes[i] != data[i]) return false;
+    }
+
+    return true;
+}
+
+size_t ScanForPattern(const uint8_t* data, size_t size, const SignaturePattern& pattern)
+{
+    const auto length = pattern.bytes.size();
+    if (length == 0 || size < length) return SignaturePattern::npos;
+
+    // Nothing to anchor on, a pattern made only of wildcards matches immediately.
+    if (pattern.anchorOffset == SignaturePattern::npos) return 0;
+
+    const auto last = size - length;
+    const auto anchor = pattern.anchorOffset;
+    const auto first = static_cast<uint8_t>(pattern.bytes[anchor]);
+    const auto second = static_cast<uint8_t>(pattern.anchorIsPair ? pattern.bytes[anchor + 1] : 0);
+
+    const auto firstVector = _mm_set1_epi8(static_cast<char>(first));
+    const auto secondVector = _mm_set1_epi8(static_cast<char>(second));
+
+    // Test the anchor at 16 candidate starts per iteration. Every load stays inside data since the anchor lies within
+    // the pattern and all 16 starts are valid.
+    size_t start = 0;
+    for (; start + 16 <= last + 1; start += 16)
+    {
+        const auto* anchorData = data + start + anchor;
+        auto hits = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(anchorData)), firstVector);
+        if (pattern.anchorIsPair)
+        {
+            hits = _mm_and_si128(hits, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(anchorData + 1)), secondVector));
+        }
+
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        while (mask != 0)
+        {
+            const auto candidate = start + CountTrailingZeros(mask);
+            if (pattern.Matches(data + candidate)) return candidate;
+            mask &= mask - 1;
+        }
+    }
+
+    for (; start <= last; start++)
+    {
+        if (data[start + anchor] == first && pattern.Matches(data + start)) return start;
+    }
+
+    return SignaturePattern::npos;
+}
+
+void ScanForPatterns(const uint8_t* data, size_t size, const std::vector<const SignaturePattern*>& patterns, std::vector<size_t>& results)
+{
+    struct Anchor
+    {
+        uint16_t pair;
+        uint32_t pattern;
+    };
+
+    std::vector<Anchor> anchors;
+    anchors.reserve(patterns.size());
+    std::vector<uint64_t> anchorBits(65536 / 64);
+    ByteSet firstBytes;
+    ByteSet secondBytes;
+
+    for (size_t i = 0; i < patterns.size(); i++)
+    {
+        if (results[i] != SignaturePattern::npos) continue;
+
+        const auto& pattern = *patterns[i];
+        if (!pattern.anchorIsPair)
+        {
+            // Rare in practice; these don't fit the pair table so scan for them on their own.
+            results[i] = ScanForPattern(data, size, pattern);
+            continue;
+        }
+
+        const auto pair = static_cast<uint16_t>(pattern.bytes[pattern.anchorOffset] | (pattern.bytes[pattern.anchorOffset + 1] << 8));
+        anchors.push_back({ pair, static_cast<uint32_t>(i) });
+        anchorBits[pair >> 6] |= 1ull << (pair & 63);
+        firstBytes.Add(static_cast<uint8_t>(pair & 0xFF));
+        secondBytes.Add(static_cast<uint8_t>(pair >> 8));
+    }
+
+    std::sort(anchors.begin(), anchors.end(), [](const Anchor& a, const Anchor& b) { return a.pair < b.pair; });
+
+    auto remaining = anchors.size();
+    if (remaining == 0) return;
+
+    // Returns false once every pattern has been found.
+    auto visit = [&](size_t i) {
+        const auto pair = static_cast<uint16_t>(data[i] | (data[i + 1] << 8));
+        if ((anchorBits[pair >> 6] & (1ull << (pair & 63))) == 0) return true;
+
+        auto it = std::lower_bound(anchors.begin(), anchors.end(), pair, [](const Anchor& a, uint16_t value) { return a.pair < value; });
+        for (; it != anchors.end() && it->pair == pair; ++it)
+        {
+            auto& result = results[it->pattern];
+            if (result != SignaturePattern::npos) continue;
+
+            const auto& pattern = *patterns[it->pattern];
+            if (i < pattern.anchorOffset) continue;
+
+            const auto start = i - pattern.anchorOffset;
+            if (start + pattern.bytes.size() > size || !pattern.Matches(data + start)) continue;
+
+            result = start;
+            remaining--;
+        }
+
+        return remaining > 0;
+    };
+
+    // The prefilter only checks each anchor byte on its own, so the pair table above still decides every candidate.
+    size_t i = HasSsse3() ? PrefilterAnchorPairs(data, size, firstBytes, secondBytes, visit) : 0;
+
+    for (; remaining > 0 && i + 1 < size; i++)
+    {
+        visit(i);
+    }
+}
+
+} // namespace counterstrikesharp::modules
@@ -0,0 +1,51 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace counterstrikesharp::modules {
+
+/**
+ * A decoded signature (-1 marks a wildcard byte) plus the anchor used to find candidate matches.
+ *
+ * The anchor is the pair of adjacent fixed bytes least likely to appear in x86-64 code, so that scanning only has to
+ * verify the full pattern at the few positions where the anchor occurs.
+ */
+struct SignaturePattern
+{
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    std::vector<int16_t> bytes;
+    size_t anchorOffset = npos;
+    bool anchorIsPair = false;
+
+    explicit SignaturePattern(std::vector<int16_t> pattern);
+
+    bool Matches(const uint8_t* data) const;
+};
+
+// Returns the offset of the first match of the pattern in data, or SignaturePattern::npos.
+size_t ScanForPattern(const uint8_t* data, size_t size, const SignaturePattern& pattern);
+
+// Finds every pattern in a single pass over data. results must be the same size as patterns; entries that are already
+// set are skipped, and entries found are set to the offset of the first match.
+void ScanForPatterns(const uint8_t* data, size_t size, const std::vector<const SignaturePattern*>& patterns, std::vector<size_t>& results);
+
+} // namespace counterstrikesharp::modules
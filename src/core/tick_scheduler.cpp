@@ -14,34 +14,118 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 
+
 #include "tick_scheduler.h"
 
+#include <algorithm>
+
 namespace counterstrikesharp {
 
-void TickScheduler::schedule(int tick, std::function<void()> callback)
+namespace {
+constexpr std::size_t BucketIndex(int tick)
+{
+    return static_cast<std::size_t>(static_cast<unsigned int>(tick) % TickScheduler::kBucketCount);
+}
+} // namespace
+
+void TickScheduler::schedule(int tick, std::function<void()>&& callback)
+{
+    m_inbox.enqueue(ScheduledTask(tick, std::move(callback)));
+}
+
+void TickScheduler::place(int tick, std::function<void()>&& callback, int currentTick, std::vector<std::function<void()>>& callbacks)
+{
+    if (tick <= currentTick)
+    {
+        callbacks.push_back(std::move(callback));
+        return;
+    }
+
+    m_scheduledCount++;
+
+    if (tick - currentTick <= kBucketCount)
+    {
+        m_buckets[BucketIndex(tick)].push_back(std::move(callback));
+        return;
+    }
+
+    m_farTasks.emplace_back(tick, std::move(callback));
+    std::push_heap(m_farTasks.begin(), m_farTasks.end(), TaskComparator());
+}
+
+void TickScheduler::rewind(int currentTick)
 {
-    std::lock_guard<std::mutex> lock(taskMutex);
-    scheduledTasks.push(std::make_pair(tick, callback));
+    // The tick count went backwards (e.g. a map change), so bucket positions no longer line up with their ticks.
+    // Move the ring back into the heap with absolute ticks so they keep waiting for the tick they asked for.
+    for (int tick = m_lastTick + 1; tick <= m_lastTick + kBucketCount; tick++)
+    {
+        for (auto& callback : m_buckets[BucketIndex(tick)])
+        {
+            m_farTasks.emplace_back(tick, std::move(callback));
+            std::push_heap(m_farTasks.begin(), m_farTasks.end(), TaskComparator());
+        }
+        m_buckets[BucketIndex(tick)].clear();
+    }
+
+    m_lastTick = currentTick - 1;
 }
 
-std::vector<std::function<void()>> TickScheduler::getCallbacks(int currentTick)
+void TickScheduler::getCallbacks(int currentTick, std::vector<std::function<void()>>& callbacks)
 {
-    std::vector<std::function<void()>> callbacksToRun;
+    if (!m_started)
+    {
+        m_lastTick = currentTick - 1;
+        m_started = true;
+    }
 
-    std::lock_guard<std::mutex> lock(taskMutex);
+    if (m_scheduledCount == 0 && m_inbox.size_approx() == 0)
+    {
+        m_lastTick = currentTick;
+        return;
+    }
 
-    if (scheduledTasks.empty())
+    if (currentTick < m_lastTick)
     {
-        return callbacksToRun;
+        rewind(currentTick);
     }
 
-    // Process tasks due for the current tick
-    while (!scheduledTasks.empty() && scheduledTasks.top().first <= currentTick)
+    // Collect the buckets we've moved past, at most one full turn of the ring.
+    const int advance = std::min(currentTick - m_lastTick, kBucketCount);
+    for (int i = 1; i <= advance && m_scheduledCount > 0; i++)
     {
-        callbacksToRun.push_back(scheduledTasks.top().second);
-        scheduledTasks.pop();
+        auto& bucket = m_buckets[BucketIndex(m_lastTick + i)];
+        m_scheduledCount -= bucket.size();
+        for (auto& callback : bucket)
+        {
+            callbacks.push_back(std::move(callback));
+        }
+        bucket.clear();
     }
 
-    return callbacksToRun;
+    m_lastTick = currentTick;
+
+    while (m_inbox.size_approx() > 0)
+    {
+        const auto count = m_inbox.try_dequeue_bulk(m_inboxBuffer.begin(), m_inboxBuffer.size());
+        if (count == 0) break;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            place(m_inboxBuffer[i].first, std::move(m_inboxBuffer[i].second), currentTick, callbacks);
+            m_inboxBuffer[i].second = nullptr;
+        }
+    }
+
+    // Pull in far tasks that are now within range of the ring.
+    while (!m_farTasks.empty() && m_farTasks.front().first - currentTick <= kBucketCount)
+    {
+        std::pop_heap(m_farTasks.begin(), m_farTasks.end(), TaskComparator());
+        auto task = std::move(m_farTasks.back());
+        m_farTasks.pop_back();
+        m_scheduledCount--;
+
+        place(task.first, std::move(task.second), currentTick, callbacks);
+    }
 }
+
 } // namespace counterstrikesharp
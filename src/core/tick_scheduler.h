@@ -14,29 +14,59 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 
+
+#pragma once
+
+#include <array>
+#include <cstddef>
 #include <functional>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
+#include <utility>
+#include <vector>
+
+#include <concurrentqueue.h>
 
 namespace counterstrikesharp {
+
+/**
+ * Runs callbacks on a given server tick.
+ *
+ * Callbacks can be scheduled from any thread; they land in a lock-free inbox that the game thread drains when it asks
+ * for due callbacks. Ticks within kBucketCount of the current tick live in a ring of per-tick buckets, so collecting
+ * the callbacks for a tick is a single bucket swap. Anything further out waits in a heap until it comes within range.
+ * Callbacks are only ever moved, never copied.
+ */
 class TickScheduler
 {
   public:
+    static constexpr int kBucketCount = 256;
+
+    void schedule(int tick, std::function<void()>&& callback);
+    // Game thread only. Appends the callbacks due on or before currentTick to callbacks.
+    void getCallbacks(int currentTick, std::vector<std::function<void()>>& callbacks);
+
+  private:
+    using ScheduledTask = std::pair<int, std::function<void()>>;
+
     struct TaskComparator
     {
-        bool operator()(const std::pair<int, std::function<void()>>& a, const std::pair<int, std::function<void()>>& b) const
-        {
-            return a.first > b.first;
-        }
+        bool operator()(const ScheduledTask& a, const ScheduledTask& b) const { return a.first > b.first; }
     };
 
-    void schedule(int tick, std::function<void()> callback);
-    std::vector<std::function<void()>> getCallbacks(int currentTick);
+    void place(int tick, std::function<void()>&& callback, int currentTick, std::vector<std::function<void()>>& callbacks);
+    void rewind(int currentTick);
 
-  private:
-    std::priority_queue<std::pair<int, std::function<void()>>, std::vector<std::pair<int, std::function<void()>>>, TaskComparator>
-        scheduledTasks;
-    std::mutex taskMutex;
+    moodycamel::ConcurrentQueue<ScheduledTask> m_inbox;
+    // Reused every tick so that draining m_inbox doesn't allocate.
+    std::vector<ScheduledTask> m_inboxBuffer = std::vector<ScheduledTask>(256);
+
+    // Bucket (tick % kBucketCount) holds the callbacks for that tick, for ticks in (m_lastTick, m_lastTick + kBucketCount].
+    std::array<std::vector<std::function<void()>>, kBucketCount> m_buckets;
+    // Min-heap on tick for everything past the end of the ring.
+    std::vector<ScheduledTask> m_farTasks;
+
+    int m_lastTick = 0;
+    bool m_started = false;
+    std::size_t m_scheduledCount = 0;
 };
+
 } // namespace counterstrikesharp
@@ -26,6 +26,7 @@ inline std::string GetRootDirectory() { return GameDirectory() + "/addons/counte
 inline std::string PluginsDirectory() { return GameDirectory() + "/addons/counterstrikesharp/plugins"; }
 inline std::string ConfigsDirectory() { return GameDirectory() + "/addons/counterstrikesharp/configs"; }
 inline std::string GamedataDirectory() { return GameDirectory() + "/addons/counterstrikesharp/gamedata"; }
+inline std::string CacheDirectory() { return GameDirectory() + "/addons/counterstrikesharp/cache"; }
 
 } // namespace utils
 } // namespace counterstrikesharp
@@ -20,6 +20,7 @@
 #include "core/game_system.h"
 #include "core/gameconfig.h"
 #include "core/global_listener.h"
+#include "core/job_system.h"
 #include "core/log.h"
 #include "core/managers/entity_manager.h"
 #include "core/tick_scheduler.h"
@@ -50,6 +51,10 @@ DLL_EXPORT void InvokeNative(counterstrikesharp::fxNativeContext& context)
     if (context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_FRAME") &&
         context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE") &&
         context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_FRAME") &&
+        context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_FRAME_WITH_PRIORITY") &&
+        context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE_WITH_PRIORITY") &&
+        context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_JOB") &&
+        context.nativeIdentifier != counterstrikesharp::hash_string_const("QUEUE_JOB_WITH_CONTINUATION") &&
         counterstrikesharp::globals::gameThreadId != std::this_thread::get_id())
     {
         counterstrikesharp::ScriptContextRaw scriptContext(context);
@@ -117,6 +122,21 @@ bool CounterStrikeSharpMMPlugin::Load(PluginId id, ISmmAPI* ismm, char* error, s
 
     CSSHARP_CORE_INFO("CoreConfig loaded.");
 
+    Log::SetAsync(globals::coreConfig->AsyncLogging, globals::coreConfig->AsyncLoggingQueueSize,
+                  globals::coreConfig->AsyncLoggingDropWhenFull);
+
+    if (!globals::coreConfig->TraceCategories.empty())
+    {
+        if (auto categories = Log::ParseTraceCategories(globals::coreConfig->TraceCategories))
+        {
+            Log::SetTraceCategories(*categories);
+        }
+        else
+        {
+            CSSHARP_CORE_WARN("Ignoring unknown trace category in TraceCategories");
+        }
+    }
+
     auto gamedata_path = std::string(utils::GamedataDirectory() + "/gamedata.json");
     globals::gameConfig = new CGameConfig(gamedata_path);
     char conf_error[255] = "";
@@ -132,6 +152,8 @@ bool CounterStrikeSharpMMPlugin::Load(PluginId id, ISmmAPI* ismm, char* error, s
     CSSHARP_CORE_INFO("Globals loaded.");
     globals::mmPlugin = &gPlugin;
 
+    globals::jobSystem.Start(globals::coreConfig->JobThreadCount, globals::coreConfig->JobAvoidGameThreadCores);
+
     CALL_GLOBAL_LISTENER(OnAllInitialized());
 
     on_activate_callback = globals::callbackManager.CreateCallback("OnMapStart");
@@ -186,6 +208,10 @@ bool CounterStrikeSharpMMPlugin::Unload(char* error, size_t maxlen)
     globals::callbackManager.ReleaseCallback(on_activate_callback);
     globals::callbackManager.ReleaseCallback(on_metamod_all_plugins_loaded_callback);
 
+    globals::jobSystem.Stop();
+
+    Log::SetAsync(false, 0, false);
+
     return true;
 }
 
@@ -198,9 +224,9 @@ void CounterStrikeSharpMMPlugin::AllPluginsLoaded()
     on_metamod_all_plugins_loaded_callback->Execute();
 }
 
-void CounterStrikeSharpMMPlugin::AddTaskForNextFrame(std::function<void()>&& task)
+void CounterStrikeSharpMMPlugin::AddTaskForNextFrame(std::function<void()>&& task, TaskPriority priority)
 {
-    m_nextTasks.try_enqueue(std::forward<decltype(task)>(task));
+    m_nextTasks.Enqueue(std::forward<decltype(task)>(task), priority);
 }
 
 void CounterStrikeSharpMMPlugin::Hook_GameFrame(bool simulating, bool bFirstTick, bool bLastTick)
@@ -214,33 +240,55 @@ void CounterStrikeSharpMMPlugin::Hook_GameFrame(bool simulating, bool bFirstTick
     VPROF_BUDGET("CS#::Hook_GameFrame", "CS# On Frame");
     globals::timerSystem.OnGameFrame(simulating);
 
-    std::vector<std::function<void()>> out_list(1024);
-
-    auto size = m_nextTasks.try_dequeue_bulk(out_list.begin(), 1024);
+    m_nextTasks.Drain();
 
-    if (size > 0)
+    // Tasks due this tick share the frame's budget, after the ones queued for this frame.
+    globals::tickScheduler.getCallbacks(globals::getGlobalVars()->tickcount, m_tickCallbacks);
+    if (m_tickCallbacks.size() > 0)
     {
-        CSSHARP_CORE_TRACE("Executing queued tasks of size: {0} on tick number {1}", size, globals::getGlobalVars()->tickcount);
+        CSSHARP_CORE_TRACE_CATEGORY(TraceTasks, "Queueing frame specific tasks of size: {0} on tick number {1}", m_tickCallbacks.size(),
+                                    globals::getGlobalVars()->tickcount);
 
-        for (size_t i = 0; i < size; i++)
+        for (auto& callback : m_tickCallbacks)
         {
-            out_list[i]();
+            m_nextTasks.EnqueueLocal(std::move(callback));
         }
+        m_tickCallbacks.clear();
     }
 
-    auto callbacks = globals::tickScheduler.getCallbacks(globals::getGlobalVars()->tickcount);
-    if (callbacks.size() > 0)
+    auto size = m_nextTasks.Run(std::chrono::microseconds(globals::coreConfig->TaskFrameBudget));
+    if (size > 0)
     {
-        CSSHARP_CORE_TRACE("Executing frame specific tasks of size: {0} on tick number {1}", callbacks.size(),
-                           globals::getGlobalVars()->tickcount);
-
-        for (auto& callback : callbacks)
-        {
-            callback();
-        }
+        CSSHARP_CORE_TRACE_CATEGORY(TraceTasks, "Executed queued tasks of size: {0} on tick number {1}", size,
+                                    globals::getGlobalVars()->tickcount);
     }
 }
 
+CON_COMMAND(css_task_stats, "Show queued task counts and how often the task frame budget ran out")
+{
+    auto print = [](const char* name, const FrameTaskQueue& queue) {
+        META_CONPRINTF("%s: %zu queued, peak %zu, budget exceeded %llu times, %llu tasks carried over\n", name, queue.GetDepth(),
+                       queue.GetPeakDepth(), static_cast<unsigned long long>(queue.GetOverrunCount()),
+                       static_cast<unsigned long long>(queue.GetDeferredCount()));
+    };
+
+    print("NextFrame", gPlugin.GetNextFrameTasks());
+    print("NextWorldUpdate", globals::serverManager.GetNextWorldUpdateTasks());
+}
+
+CON_COMMAND(css_job_stats, "Show job thread pool usage and timings")
+{
+    auto stats = globals::jobSystem.GetStats();
+    auto average = [](std::uint64_t total, std::uint64_t count) { return count > 0 ? total / count : 0; };
+
+    META_CONPRINTF("%zu job threads, %zu queued, %zu running\n", stats.workers, stats.queued, stats.running);
+    META_CONPRINTF("%llu completed (%llu stolen), average wait %lluus, average run %lluus, max run %lluus\n",
+                   static_cast<unsigned long long>(stats.completed), static_cast<unsigned long long>(stats.stolen),
+                   static_cast<unsigned long long>(average(stats.totalWaitMicroseconds, stats.completed)),
+                   static_cast<unsigned long long>(average(stats.totalRunMicroseconds, stats.completed)),
+                   static_cast<unsigned long long>(stats.maxRunMicroseconds));
+}
+
 // Potentially might not work
 void CounterStrikeSharpMMPlugin::OnLevelInit(
     char const* pMapName, char const* pMapEntities, char const* pOldLevel, char const* pLandmarkName, bool loadGame, bool background)
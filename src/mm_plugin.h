@@ -26,6 +26,7 @@
 #include <vector>
 #include "entitysystem.h"
 #include "concurrentqueue.h"
+#include "core/frame_task_queue.h"
 
 namespace counterstrikesharp {
 class ScriptCallback;
@@ -49,7 +50,8 @@ class CounterStrikeSharpMMPlugin : public ISmmPlugin, public IMetamodListener
     void OnLevelShutdown() override;
     void Hook_GameFrame(bool simulating, bool bFirstTick, bool bLastTick);
     void Hook_StartupServer(const GameSessionConfiguration_t& config, ISource2WorldSession*, const char*);
-    void AddTaskForNextFrame(std::function<void()>&& task);
+    void AddTaskForNextFrame(std::function<void()>&& task, TaskPriority priority = TaskPriority::Normal);
+    FrameTaskQueue& GetNextFrameTasks() { return m_nextTasks; }
 
     void Hook_RegisterLoopMode(const char* pszLoopModeName, ILoopModeFactory* pLoopModeFactory, void** ppGlobalPointer);
     IEngineService* Hook_FindService(const char* serviceName);
@@ -65,7 +67,9 @@ class CounterStrikeSharpMMPlugin : public ISmmPlugin, public IMetamodListener
     const char* GetLogTag() override;
 
   private:
-    moodycamel::ConcurrentQueue<std::function<void()>> m_nextTasks;
+    FrameTaskQueue m_nextTasks;
+    // Reused every frame to collect the TickScheduler callbacks due this tick.
+    std::vector<std::function<void()>> m_tickCallbacks;
 };
 
 static ScriptCallback* on_activate_callback;
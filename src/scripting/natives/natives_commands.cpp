@@ -151,7 +151,16 @@ static void IssueClientCommandFromServer(ScriptContext& script_context)
 
     CCommandContext context(CommandTarget_t::CT_NO_TARGET, CPlayerSlot(slot));
 
+    globals::conCommandManager.floodLimiter.SetBypass(true);
     globals::cvars->DispatchConCommand(handle, context, args);
+    globals::conCommandManager.floodLimiter.SetBypass(false);
+}
+
+static int GetClientDroppedCommandCount(ScriptContext& script_context)
+{
+    auto slot = script_context.GetArgument<int>(0);
+
+    return globals::conCommandManager.floodLimiter.GetDroppedCount(slot);
 }
 
 static const char* GetClientConVarValue(ScriptContext& script_context)
@@ -240,6 +249,7 @@ REGISTER_NATIVES(commands, {
 
     ScriptEngine::RegisterNativeHandler("ISSUE_CLIENT_COMMAND", IssueClientCommand);
     ScriptEngine::RegisterNativeHandler("ISSUE_CLIENT_COMMAND_FROM_SERVER", IssueClientCommandFromServer);
+    ScriptEngine::RegisterNativeHandler("GET_CLIENT_DROPPED_COMMAND_COUNT", GetClientDroppedCommandCount);
     ScriptEngine::RegisterNativeHandler("GET_CLIENT_CONVAR_VALUE", GetClientConVarValue);
     ScriptEngine::RegisterNativeHandler("SET_FAKE_CLIENT_CONVAR_VALUE", SetFakeClientConVarValue);
     ScriptEngine::RegisterNativeHandler("REPLICATE_CONVAR", ReplicateConVar);
@@ -14,6 +14,8 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 
+#include <cstring>
+
 #include "mm_plugin.h"
 #include "core/timer_system.h"
 #include "scripting/autonative.h"
@@ -528,11 +530,177 @@ void DHookSetParam(ScriptContext& script_context)
     }
 }
 
+namespace {
+template <class T> struct TypeTag
+{
+    using type = T;
+};
+
+// Invokes fn with a TypeTag for the C++ type a DataType_t maps to. Returns false for unsupported types.
+template <class Fn> bool VisitDataType(DataType_t dataType, Fn&& fn)
+{
+    switch (dataType)
+    {
+        case DATA_TYPE_BOOL:
+            fn(TypeTag<bool>{});
+            return true;
+        case DATA_TYPE_CHAR:
+            fn(TypeTag<char>{});
+            return true;
+        case DATA_TYPE_UCHAR:
+            fn(TypeTag<unsigned char>{});
+            return true;
+        case DATA_TYPE_SHORT:
+            fn(TypeTag<short>{});
+            return true;
+        case DATA_TYPE_USHORT:
+            fn(TypeTag<unsigned short>{});
+            return true;
+        case DATA_TYPE_INT:
+            fn(TypeTag<int>{});
+            return true;
+        case DATA_TYPE_UINT:
+            fn(TypeTag<unsigned int>{});
+            return true;
+        case DATA_TYPE_LONG:
+            fn(TypeTag<long>{});
+            return true;
+        case DATA_TYPE_ULONG:
+            fn(TypeTag<unsigned long>{});
+            return true;
+        case DATA_TYPE_LONG_LONG:
+            fn(TypeTag<long long>{});
+            return true;
+        case DATA_TYPE_ULONG_LONG:
+            fn(TypeTag<unsigned long long>{});
+            return true;
+        case DATA_TYPE_FLOAT:
+            fn(TypeTag<float>{});
+            return true;
+        case DATA_TYPE_DOUBLE:
+            fn(TypeTag<double>{});
+            return true;
+        case DATA_TYPE_POINTER:
+            fn(TypeTag<void*>{});
+            return true;
+        case DATA_TYPE_STRING:
+            fn(TypeTag<const char*>{});
+            return true;
+        default:
+            return false;
+    }
+}
+} // namespace
+
+// Copies every parameter of the hooked call, followed by the return value, into 8-byte slots of the given buffer.
+// Slots use the same layout as native arguments: the value in the low bytes and the rest zeroed.
+int DHookGetParams(ScriptContext& script_context)
+{
+    auto hook = script_context.GetArgument<dyno::Hook*>(0);
+    auto buffer = script_context.GetArgument<uint64_t*>(1);
+    auto bufferSlots = script_context.GetArgument<int>(2);
+
+    if (hook == nullptr)
+    {
+        script_context.ThrowNativeError("Invalid hook");
+        return 0;
+    }
+
+    auto function = FindHookedFunction(hook);
+    if (function == nullptr)
+    {
+        script_context.ThrowNativeError("Hook is not owned by a memory function");
+        return 0;
+    }
+
+    auto slotCount = static_cast<int>(function->m_Args.size()) + 1;
+    if (buffer == nullptr || bufferSlots < slotCount)
+    {
+        script_context.ThrowNativeError("Parameter buffer needs %d slots, got %d", slotCount, bufferSlots);
+        return 0;
+    }
+
+    for (int i = 0; i < slotCount - 1; i++)
+    {
+        buffer[i] = 0;
+        VisitDataType(function->m_Args[i], [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            auto value = hook->getArgument<T>(i);
+            memcpy(&buffer[i], &value, sizeof(T));
+        });
+    }
+
+    auto& returnSlot = buffer[slotCount - 1];
+    returnSlot = 0;
+    VisitDataType(function->m_eReturnType, [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        auto value = hook->getReturnValue<T>();
+        memcpy(&returnSlot, &value, sizeof(T));
+    });
+
+    return slotCount;
+}
+
+// Writes back the slots selected by mask, using the layout of DYNAMIC_HOOK_GET_PARAMS. Bit N selects parameter N;
+// the bit after the last parameter selects the return value.
+void DHookSetParams(ScriptContext& script_context)
+{
+    auto hook = script_context.GetArgument<dyno::Hook*>(0);
+    auto buffer = script_context.GetArgument<uint64_t*>(1);
+    auto bufferSlots = script_context.GetArgument<int>(2);
+    auto mask = script_context.GetArgument<uint64_t>(3);
+
+    if (hook == nullptr)
+    {
+        script_context.ThrowNativeError("Invalid hook");
+        return;
+    }
+
+    auto function = FindHookedFunction(hook);
+    if (function == nullptr)
+    {
+        script_context.ThrowNativeError("Hook is not owned by a memory function");
+        return;
+    }
+
+    auto slotCount = static_cast<int>(function->m_Args.size()) + 1;
+    if (buffer == nullptr || bufferSlots < slotCount)
+    {
+        script_context.ThrowNativeError("Parameter buffer needs %d slots, got %d", slotCount, bufferSlots);
+        return;
+    }
+
+    for (int i = 0; i < slotCount - 1 && i < 64; i++)
+    {
+        if ((mask & (1ull << i)) == 0) continue;
+
+        VisitDataType(function->m_Args[i], [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            T value;
+            memcpy(&value, &buffer[i], sizeof(T));
+            hook->setArgument(i, value);
+        });
+    }
+
+    auto returnBit = slotCount - 1;
+    if (returnBit < 64 && (mask & (1ull << returnBit)) != 0)
+    {
+        VisitDataType(function->m_eReturnType, [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            T value;
+            memcpy(&value, &buffer[returnBit], sizeof(T));
+            hook->setReturnValue(value);
+        });
+    }
+}
+
 REGISTER_NATIVES(dynamichooks, {
     ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_GET_REGISTER", DHookGetRegister);
     ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_GET_RETURN", DHookGetReturn);
     ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_SET_RETURN", DHookSetReturn);
     ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_GET_PARAM", DHookGetParam);
     ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_SET_PARAM", DHookSetParam);
+    ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_GET_PARAMS", DHookGetParams);
+    ScriptEngine::RegisterNativeHandler("DYNAMIC_HOOK_SET_PARAMS", DHookSetParams);
 })
 } // namespace counterstrikesharp
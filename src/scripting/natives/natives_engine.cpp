@@ -154,6 +154,37 @@ void QueueTaskForNextWorldUpdate(ScriptContext& script_context)
     });
 }
 
+void QueueTaskForNextFrameWithPriority(ScriptContext& script_context)
+{
+    auto priority = script_context.GetArgument<int>(0);
+    auto func = script_context.GetArgument<void*>(1);
+
+    if (priority < static_cast<int>(TaskPriority::High) || priority > static_cast<int>(TaskPriority::Low))
+    {
+        script_context.ThrowNativeError("Invalid task priority %d", priority);
+        return;
+    }
+
+    typedef void(voidfunc)(void);
+    globals::mmPlugin->AddTaskForNextFrame([func]() { reinterpret_cast<voidfunc*>(func)(); }, static_cast<TaskPriority>(priority));
+}
+
+void QueueTaskForNextWorldUpdateWithPriority(ScriptContext& script_context)
+{
+    auto priority = script_context.GetArgument<int>(0);
+    auto func = script_context.GetArgument<void*>(1);
+
+    if (priority < static_cast<int>(TaskPriority::High) || priority > static_cast<int>(TaskPriority::Low))
+    {
+        script_context.ThrowNativeError("Invalid task priority %d", priority);
+        return;
+    }
+
+    typedef void(voidfunc)(void);
+    globals::serverManager.AddTaskForNextWorldUpdate([func]() { reinterpret_cast<voidfunc*>(func)(); },
+                                                     static_cast<TaskPriority>(priority));
+}
+
 void QueueTaskForFrame(ScriptContext& script_context)
 {
     auto tick = script_context.GetArgument<int>(0);
@@ -256,6 +287,8 @@ REGISTER_NATIVES(engine, {
     ScriptEngine::RegisterNativeHandler("GET_TICKED_TIME", GetTickedTime);
     ScriptEngine::RegisterNativeHandler("QUEUE_TASK_FOR_NEXT_FRAME", QueueTaskForNextFrame);
     ScriptEngine::RegisterNativeHandler("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE", QueueTaskForNextWorldUpdate);
+    ScriptEngine::RegisterNativeHandler("QUEUE_TASK_FOR_NEXT_FRAME_WITH_PRIORITY", QueueTaskForNextFrameWithPriority);
+    ScriptEngine::RegisterNativeHandler("QUEUE_TASK_FOR_NEXT_WORLD_UPDATE_WITH_PRIORITY", QueueTaskForNextWorldUpdateWithPriority);
     ScriptEngine::RegisterNativeHandler("QUEUE_TASK_FOR_FRAME", QueueTaskForFrame);
     ScriptEngine::RegisterNativeHandler("GET_VALVE_INTERFACE", GetValveInterface);
     ScriptEngine::RegisterNativeHandler("GET_COMMAND_PARAM_VALUE", GetCommandParamValue);
@@ -272,6 +272,157 @@ SoundEventGuid_t EmitSoundFilter(ScriptContext& script_context)
     return ret.m_nGuid;
 }
 
+int QueryEntitiesInSphere(ScriptContext& script_context)
+{
+    if (!globals::entitySystem)
+    {
+        script_context.ThrowNativeError("Entity system is not yet initialized");
+        return 0;
+    }
+
+    auto center = script_context.GetArgument<Vector*>(0);
+    auto radius = script_context.GetArgument<float>(1);
+    auto classname = script_context.GetArgument<const char*>(2);
+    auto results = script_context.GetArgument<uint32_t*>(3);
+    auto maxResults = script_context.GetArgument<int>(4);
+
+    if (!center || !results)
+    {
+        script_context.ThrowNativeError("Invalid center or result buffer");
+        return 0;
+    }
+
+    return globals::entityManager.spatialIndex.QuerySphere(*center, radius, classname, results, maxResults);
+}
+
+int QueryEntitiesInBox(ScriptContext& script_context)
+{
+    if (!globals::entitySystem)
+    {
+        script_context.ThrowNativeError("Entity system is not yet initialized");
+        return 0;
+    }
+
+    auto mins = script_context.GetArgument<Vector*>(0);
+    auto maxs = script_context.GetArgument<Vector*>(1);
+    auto classname = script_context.GetArgument<const char*>(2);
+    auto results = script_context.GetArgument<uint32_t*>(3);
+    auto maxResults = script_context.GetArgument<int>(4);
+
+    if (!mins || !maxs || !results)
+    {
+        script_context.ThrowNativeError("Invalid bounds or result buffer");
+        return 0;
+    }
+
+    return globals::entityManager.spatialIndex.QueryBox(*mins, *maxs, classname, results, maxResults);
+}
+
+int QueryNearestEntities(ScriptContext& script_context)
+{
+    if (!globals::entitySystem)
+    {
+        script_context.ThrowNativeError("Entity system is not yet initialized");
+        return 0;
+    }
+
+    auto center = script_context.GetArgument<Vector*>(0);
+    auto maxDistance = script_context.GetArgument<float>(1);
+    auto classname = script_context.GetArgument<const char*>(2);
+    auto results = script_context.GetArgument<uint32_t*>(3);
+    auto maxResults = script_context.GetArgument<int>(4);
+
+    if (!center || !results)
+    {
+        script_context.ThrowNativeError("Invalid center or result buffer");
+        return 0;
+    }
+
+    return globals::entityManager.spatialIndex.QueryNearest(*center, maxDistance, classname, results, maxResults);
+}
+
+int AllocateEntityDataSlot(ScriptContext& script_context)
+{
+    auto size = script_context.GetArgument<int>(0);
+    auto owner = script_context.GetArgument<const char*>(1);
+
+    auto slot = globals::entityManager.entityData.AllocateSlot(size, owner);
+    if (slot == EntityDataStore::kInvalidSlot)
+    {
+        script_context.ThrowNativeError("Invalid entity data size %d", size);
+    }
+
+    return slot;
+}
+
+void FreeEntityDataSlot(ScriptContext& script_context)
+{
+    auto slot = script_context.GetArgument<int>(0);
+
+    if (!globals::entityManager.entityData.FreeSlot(slot))
+    {
+        script_context.ThrowNativeError("Invalid entity data slot %d", slot);
+    }
+}
+
+void* GetEntityData(ScriptContext& script_context)
+{
+    auto slot = script_context.GetArgument<int>(0);
+    auto ref = script_context.GetArgument<unsigned int>(1);
+    auto create = script_context.GetArgument<bool>(2);
+
+    if (!globals::entityManager.entityData.IsValidSlot(slot))
+    {
+        script_context.ThrowNativeError("Invalid entity data slot %d", slot);
+        return nullptr;
+    }
+
+    // Only hand out fresh storage for entities that actually exist, otherwise a stale handle
+    // could claim the entry of whichever entity re-uses its index next.
+    if (create)
+    {
+        if (!globals::entitySystem)
+        {
+            script_context.ThrowNativeError("Entity system is not yet initialized");
+            return nullptr;
+        }
+
+        CBaseHandle hndl(ref);
+        if (!hndl.IsValid() || globals::entitySystem->GetEntityInstance(hndl) == nullptr) return nullptr;
+    }
+
+    return globals::entityManager.entityData.Get(slot, ref, create);
+}
+
+void* GetEntityDataChunkTable(ScriptContext& script_context)
+{
+    auto slot = script_context.GetArgument<int>(0);
+
+    auto table = globals::entityManager.entityData.GetChunkTable(slot);
+    if (!table)
+    {
+        script_context.ThrowNativeError("Invalid entity data slot %d", slot);
+        return nullptr;
+    }
+
+    return const_cast<uint8_t**>(table);
+}
+
+void ClearEntityData(ScriptContext& script_context)
+{
+    auto slot = script_context.GetArgument<int>(0);
+    auto ref = script_context.GetArgument<unsigned int>(1);
+
+    globals::entityManager.entityData.Clear(slot, ref);
+}
+
+uint64 GetEntityDataMemoryUsage(ScriptContext& script_context)
+{
+    auto owner = script_context.GetArgument<const char*>(0);
+
+    return globals::entityManager.entityData.GetMemoryUsage(owner);
+}
+
 REGISTER_NATIVES(entities, {
     ScriptEngine::RegisterNativeHandler("GET_ENTITY_FROM_INDEX", GetEntityFromIndex);
     ScriptEngine::RegisterNativeHandler("GET_USERID_FROM_INDEX", GetUserIdFromIndex);
@@ -290,5 +441,14 @@ REGISTER_NATIVES(entities, {
     ScriptEngine::RegisterNativeHandler("ACCEPT_INPUT", AcceptInput);
     ScriptEngine::RegisterNativeHandler("ADD_ENTITY_IO_EVENT", AddEntityIOEvent);
     ScriptEngine::RegisterNativeHandler("EMIT_SOUND_FILTER", EmitSoundFilter);
+    ScriptEngine::RegisterNativeHandler("QUERY_ENTITIES_IN_SPHERE", QueryEntitiesInSphere);
+    ScriptEngine::RegisterNativeHandler("QUERY_ENTITIES_IN_BOX", QueryEntitiesInBox);
+    ScriptEngine::RegisterNativeHandler("QUERY_NEAREST_ENTITIES", QueryNearestEntities);
+    ScriptEngine::RegisterNativeHandler("ALLOCATE_ENTITY_DATA_SLOT", AllocateEntityDataSlot);
+    ScriptEngine::RegisterNativeHandler("FREE_ENTITY_DATA_SLOT", FreeEntityDataSlot);
+    ScriptEngine::RegisterNativeHandler("GET_ENTITY_DATA", GetEntityData);
+    ScriptEngine::RegisterNativeHandler("GET_ENTITY_DATA_CHUNK_TABLE", GetEntityDataChunkTable);
+    ScriptEngine::RegisterNativeHandler("CLEAR_ENTITY_DATA", ClearEntityData);
+    ScriptEngine::RegisterNativeHandler("GET_ENTITY_DATA_MEMORY_USAGE", GetEntityDataMemoryUsage);
 })
 } // namespace counterstrikesharp
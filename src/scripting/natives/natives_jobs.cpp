@@ -0,0 +1,64 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+
+#include <scripting/autonative.h>
+#include <scripting/script_engine.h>
+
+#include "core/globals.h"
+#include "core/job_system.h"
+
+namespace counterstrikesharp {
+
+uint64_t QueueJob(ScriptContext& script_context)
+{
+    auto work = script_context.GetArgument<void*>(0);
+    auto discard = script_context.GetArgument<void*>(1);
+
+    typedef void(voidfunc)(void);
+    auto id = globals::jobSystem.Submit([work]() { reinterpret_cast<voidfunc*>(work)(); }, nullptr,
+                                        [discard]() { reinterpret_cast<voidfunc*>(discard)(); });
+    if (id == 0)
+    {
+        script_context.ThrowNativeError("Job system is not running");
+    }
+
+    return id;
+}
+
+uint64_t QueueJobWithContinuation(ScriptContext& script_context)
+{
+    auto work = script_context.GetArgument<void*>(0);
+    auto continuation = script_context.GetArgument<void*>(1);
+    auto discard = script_context.GetArgument<void*>(2);
+
+    typedef void(voidfunc)(void);
+    auto id = globals::jobSystem.Submit([work]() { reinterpret_cast<voidfunc*>(work)(); },
+                                        [continuation]() { reinterpret_cast<voidfunc*>(continuation)(); },
+                                        [discard]() { reinterpret_cast<voidfunc*>(discard)(); });
+    if (id == 0)
+    {
+        script_context.ThrowNativeError("Job system is not running");
+    }
+
+    return id;
+}
+
+REGISTER_NATIVES(jobs, {
+    ScriptEngine::RegisterNativeHandler("QUEUE_JOB", QueueJob);
+    ScriptEngine::RegisterNativeHandler("QUEUE_JOB_WITH_CONTINUATION", QueueJobWithContinuation);
+})
+} // namespace counterstrikesharp
@@ -14,8 +14,12 @@
  *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
  */
 
+#include <cstring>
 #include <ios>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 
 #include "core/function.h"
 #include "core/log.h"
@@ -24,7 +28,72 @@
 #include "scripting/script_engine.h"
 
 namespace counterstrikesharp {
-std::vector<ValveFunction*> m_managed_ptrs;
+
+namespace {
+// ValveFunctions handed out to managed code are interned, so that wrapping the same function repeatedly returns the
+// same instance (and shares its hooks) instead of allocating a new one that lives forever.
+struct FunctionKey
+{
+    void* addr;
+    Convention_t convention;
+    DataType_t returnType;
+    std::vector<DataType_t> args;
+
+    bool operator==(const FunctionKey& other) const
+    {
+        return addr == other.addr && convention == other.convention && returnType == other.returnType && args == other.args;
+    }
+};
+
+struct FunctionKeyHash
+{
+    size_t operator()(const FunctionKey& key) const
+    {
+        size_t hash = std::hash<void*>()(key.addr);
+        hash = hash * 31 + key.convention;
+        hash = hash * 31 + key.returnType;
+        for (auto arg : key.args)
+        {
+            hash = hash * 31 + arg;
+        }
+        return hash;
+    }
+};
+
+std::unordered_map<FunctionKey, std::unique_ptr<ValveFunction>, FunctionKeyHash> g_managedFunctions;
+
+// Keyed by "<binary>\0<signature>". Failed lookups are remembered too, the modules don't change while loaded.
+std::unordered_map<std::string, void*> g_signatureAddresses;
+
+std::vector<DataType_t> GetArgumentTypes(ScriptContext& script_context, int firstIndex, int count)
+{
+    std::vector<DataType_t> args;
+    args.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        args.push_back(script_context.GetArgument<DataType_t>(firstIndex + i));
+    }
+    return args;
+}
+
+ValveFunction* GetOrCreateFunction(void* addr, Convention_t convention, std::vector<DataType_t> args, DataType_t returnType, bool& created)
+{
+    FunctionKey key{ addr, convention, returnType, std::move(args) };
+
+    auto it = g_managedFunctions.find(key);
+    created = it == g_managedFunctions.end();
+    if (!created)
+    {
+        return it->second.get();
+    }
+
+    auto function = std::make_unique<ValveFunction>(addr, convention, key.args, returnType);
+    auto pFunction = function.get();
+    g_managedFunctions.emplace(std::move(key), std::move(function));
+
+    return pFunction;
+}
+} // namespace
 
 void* FindSignatureNative(ScriptContext& scriptContext)
 {
@@ -42,7 +111,17 @@ ValveFunction* CreateVirtualFunctionBySignature(ScriptContext& script_context)
     auto num_arguments = script_context.GetArgument<int>(3);
     auto return_type = script_context.GetArgument<DataType_t>(4);
 
-    auto* function_addr = FindSignature(binary_name, signature_hex_string);
+    std::string signatureKey = binary_name;
+    signatureKey.push_back('\0');
+    signatureKey.append(signature_hex_string);
+
+    auto signatureIt = g_signatureAddresses.find(signatureKey);
+    if (signatureIt == g_signatureAddresses.end())
+    {
+        signatureIt = g_signatureAddresses.emplace(std::move(signatureKey), FindSignature(binary_name, signature_hex_string)).first;
+    }
+
+    auto* function_addr = signatureIt->second;
 
     if (function_addr == nullptr)
     {
@@ -50,18 +129,17 @@ ValveFunction* CreateVirtualFunctionBySignature(ScriptContext& script_context)
         return nullptr;
     }
 
-    auto args = std::vector<DataType_t>();
-    for (int i = 0; i < num_arguments; i++)
-    {
-        args.push_back(script_context.GetArgument<DataType_t>(5 + i));
-    }
+    bool created;
+    auto function = GetOrCreateFunction(function_addr, CONV_CDECL, GetArgumentTypes(script_context, 5, num_arguments), return_type, created);
 
-    auto function = new ValveFunction(function_addr, CONV_CDECL, args, return_type);
-    function->SetSignature(signature_hex_string);
+    if (created)
+    {
+        // Point at the memoized key rather than the script context, which is only valid for this call.
+        function->SetSignature(signatureIt->first.c_str() + strlen(binary_name) + 1);
 
-    CSSHARP_CORE_TRACE("Created virtual function, pointer found at {}, signature {}", function_addr, signature_hex_string);
+        CSSHARP_CORE_TRACE("Created virtual function, pointer found at {}, signature {}", function_addr, signature_hex_string);
+    }
 
-    m_managed_ptrs.push_back(function);
     return function;
 }
 
@@ -81,16 +159,14 @@ ValveFunction* CreateVirtualFunction(ScriptContext& script_context)
 
     auto function_addr = (void*)vtable[vtable_offset];
 
-    auto args = std::vector<DataType_t>();
-    for (int i = 0; i < num_arguments; i++)
+    bool created;
+    auto function = GetOrCreateFunction(function_addr, CONV_THISCALL, GetArgumentTypes(script_context, 4, num_arguments), return_type, created);
+
+    if (created)
     {
-        args.push_back(script_context.GetArgument<DataType_t>(4 + i));
+        function->SetOffset(vtable_offset);
     }
 
-    auto function = new ValveFunction(function_addr, CONV_THISCALL, args, return_type);
-    function->SetOffset(vtable_offset);
-
-    m_managed_ptrs.push_back(function);
     return function;
 }
 
@@ -124,6 +200,65 @@ void UnhookFunction(ScriptContext& script_context)
     function->RemoveHook(callback, post);
 }
 
+void AddFunctionHookFilter(ScriptContext& script_context)
+{
+    auto function = script_context.GetArgument<ValveFunction*>(0);
+    auto callback = script_context.GetArgument<CallbackT>(1);
+    auto post = script_context.GetArgument<bool>(2);
+    auto paramIndex = script_context.GetArgument<int>(3);
+    auto op = script_context.GetArgument<int>(4);
+    auto floatValue = script_context.GetArgument<double>(5);
+    auto intValue = script_context.GetArgument<int64_t>(6);
+    auto classname = script_context.GetArgument<const char*>(7);
+
+    if (!function)
+    {
+        script_context.ThrowNativeError("Invalid function pointer");
+        return;
+    }
+
+    if (op < static_cast<int>(HookFilterOp::Equal) || op > static_cast<int>(HookFilterOp::Classname))
+    {
+        script_context.ThrowNativeError("Invalid hook filter operator %d", op);
+        return;
+    }
+
+    HookFilterCondition condition{ paramIndex, static_cast<HookFilterOp>(op), floatValue, intValue, classname ? classname : "" };
+    if (!function->AddHookFilter(callback, post, std::move(condition)))
+    {
+        script_context.ThrowNativeError("Hook filter operator %d cannot be applied to parameter %d", op, paramIndex);
+    }
+}
+
+void ClearFunctionHookFilters(ScriptContext& script_context)
+{
+    auto function = script_context.GetArgument<ValveFunction*>(0);
+    auto callback = script_context.GetArgument<CallbackT>(1);
+    auto post = script_context.GetArgument<bool>(2);
+
+    if (!function)
+    {
+        script_context.ThrowNativeError("Invalid function pointer");
+        return;
+    }
+
+    function->ClearHookFilters(callback, post);
+}
+
+uint64_t GetFunctionHookCallCount(ScriptContext& script_context)
+{
+    auto function = script_context.GetArgument<ValveFunction*>(0);
+    auto filtered = script_context.GetArgument<bool>(1);
+
+    if (!function)
+    {
+        script_context.ThrowNativeError("Invalid function pointer");
+        return 0;
+    }
+
+    return filtered ? function->m_filteredCalls : function->m_dispatchedCalls;
+}
+
 void ExecuteVirtualFunction(ScriptContext& script_context)
 {
     auto function = script_context.GetArgument<ValveFunction*>(0);
@@ -165,6 +300,9 @@ REGISTER_NATIVES(memory, {
     ScriptEngine::RegisterNativeHandler("EXECUTE_VIRTUAL_FUNCTION", ExecuteVirtualFunction);
     ScriptEngine::RegisterNativeHandler("HOOK_FUNCTION", HookFunction);
     ScriptEngine::RegisterNativeHandler("UNHOOK_FUNCTION", UnhookFunction);
+    ScriptEngine::RegisterNativeHandler("ADD_FUNCTION_HOOK_FILTER", AddFunctionHookFilter);
+    ScriptEngine::RegisterNativeHandler("CLEAR_FUNCTION_HOOK_FILTERS", ClearFunctionHookFilters);
+    ScriptEngine::RegisterNativeHandler("GET_FUNCTION_HOOK_CALL_COUNT", GetFunctionHookCallCount);
     ScriptEngine::RegisterNativeHandler("FIND_SIGNATURE", FindSignatureNative);
     ScriptEngine::RegisterNativeHandler("GET_NETWORK_VECTOR_SIZE", GetNetworkVectorSize);
     ScriptEngine::RegisterNativeHandler("GET_NETWORK_VECTOR_ELEMENT_AT", GetNetworkVectorElementAt);
@@ -128,10 +128,34 @@ VoiceFlag_t GetClientVoiceFlags(ScriptContext& scriptContext)
     return pPlayer->GetVoiceFlags();
 }
 
+void SetClientListenMasks(ScriptContext& scriptContext)
+{
+    auto receiver = scriptContext.GetArgument<CEntityInstance*>(0);
+    auto muteMask = scriptContext.GetArgument<uint64>(1);
+    auto hearMask = scriptContext.GetArgument<uint64>(2);
+
+    if (!receiver)
+    {
+        scriptContext.ThrowNativeError("Receiver is a null pointer");
+        return;
+    }
+
+    auto pPlayer = globals::playerManager.GetPlayerBySlot(receiver->GetEntityIndex().Get() - 1);
+
+    if (pPlayer == nullptr)
+    {
+        scriptContext.ThrowNativeError("Invalid receiver");
+        return;
+    }
+
+    pPlayer->SetListenMasks(muteMask, hearMask);
+}
+
 REGISTER_NATIVES(voice, {
     ScriptEngine::RegisterNativeHandler("SET_CLIENT_LISTENING", SetClientListening);
     ScriptEngine::RegisterNativeHandler("GET_CLIENT_LISTENING", GetClientListening);
     ScriptEngine::RegisterNativeHandler("SET_CLIENT_VOICE_FLAGS", SetClientVoiceFlags);
     ScriptEngine::RegisterNativeHandler("GET_CLIENT_VOICE_FLAGS", GetClientVoiceFlags);
+    ScriptEngine::RegisterNativeHandler("SET_CLIENT_LISTEN_MASKS", SetClientListenMasks);
 })
 } // namespace counterstrikesharp
@@ -0,0 +1,101 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/case_insensitive_hash_map.h"
+
+#include <string>
+
+#include "native_test.h"
+
+using namespace counterstrikesharp;
+
+namespace {
+
+void TestFindIgnoresCase()
+{
+    CaseInsensitiveHashMap<int> map;
+    CHECK(map.Find("css_plugins") == nullptr);
+
+    map.Insert("css_Plugins", 1);
+    map.Insert("say", 2);
+
+    CHECK(map.Find("css_plugins") != nullptr && *map.Find("css_plugins") == 1);
+    CHECK(map.Find("CSS_PLUGINS") != nullptr && *map.Find("CSS_PLUGINS") == 1);
+    CHECK(map.Find("SaY") != nullptr && *map.Find("SaY") == 2);
+    CHECK(map.Find("say_team") == nullptr);
+    CHECK(map.Find("sa") == nullptr);
+    CHECK(map.Find("") == nullptr);
+}
+
+void TestInsertOverwrites()
+{
+    CaseInsensitiveHashMap<int> map;
+    map.Insert("kill", 1);
+    auto& value = map.Insert("KILL", 2);
+
+    CHECK_EQ(value, 2);
+    CHECK(map.Find("kill") == &value);
+}
+
+void TestMissDoesNotInsert()
+{
+    CaseInsensitiveHashMap<int> map;
+    map.Insert("jointeam", 1);
+
+    // Unknown commands used to be inserted by operator[]; a miss must leave the map untouched.
+    for (int i = 0; i < 10000; i++)
+    {
+        CHECK(map.Find("unknown_" + std::to_string(i)) == nullptr);
+    }
+    CHECK(map.Find("jointeam") != nullptr);
+}
+
+void TestGrowKeepsEntries()
+{
+    CaseInsensitiveHashMap<int> map;
+    for (int i = 0; i < 5000; i++)
+    {
+        map.Insert("Command_" + std::to_string(i), i);
+    }
+
+    for (int i = 0; i < 5000; i++)
+    {
+        auto value = map.Find("command_" + std::to_string(i));
+        CHECK(value != nullptr && *value == i);
+    }
+}
+
+void TestOnlyAsciiIsFolded()
+{
+    CaseInsensitiveHashMap<int> map;
+    map.Insert("\xC3\x84", 1);
+
+    CHECK(map.Find("\xC3\x84") != nullptr);
+    CHECK(map.Find("\xC3\xA4") == nullptr);
+}
+
+} // namespace
+
+int main()
+{
+    TestFindIgnoresCase();
+    TestInsertOverwrites();
+    TestMissDoesNotInsert();
+    TestGrowKeepsEntries();
+    TestOnlyAsciiIsFolded();
+
+    return native_test::Result();
+}
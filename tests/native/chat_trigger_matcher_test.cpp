@@ -0,0 +1,96 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/chat_trigger_matcher.h"
+
+#include <string>
+#include <vector>
+
+#include "native_test.h"
+
+using namespace counterstrikesharp;
+
+namespace {
+
+void TestMatchesInConfiguredOrder()
+{
+    ChatTriggerMatcher matcher;
+    matcher.Compile({ "!", "!!", ".", "/" });
+
+    std::string_view prefix;
+    CHECK(matcher.Match("!kick bob", prefix) && prefix == "!");
+    // "!" comes first in the config, so it wins over the longer "!!".
+    CHECK(matcher.Match("!!kick bob", prefix) && prefix == "!");
+    CHECK(matcher.Match(".help", prefix) && prefix == ".");
+    CHECK(!matcher.Match("hello", prefix));
+    CHECK(!matcher.Match("", prefix));
+}
+
+void TestMultiByteTriggers()
+{
+    ChatTriggerMatcher matcher;
+    matcher.Compile({ "css ", "cs" });
+
+    std::string_view prefix;
+    CHECK(matcher.Match("css plugins", prefix) && prefix == "css ");
+    CHECK(matcher.Match("cssplugins", prefix) && prefix == "cs");
+    CHECK(!matcher.Match("c", prefix));
+}
+
+void TestEmptyTriggerMatchesEverything()
+{
+    ChatTriggerMatcher matcher;
+    matcher.Compile({ "!", "" });
+
+    std::string_view prefix;
+    CHECK(matcher.Match("!kick", prefix) && prefix == "!");
+    CHECK(matcher.Match("hello", prefix) && prefix.empty());
+    CHECK(matcher.Match("", prefix) && prefix.empty());
+}
+
+void TestRecompileReplacesTriggers()
+{
+    ChatTriggerMatcher matcher;
+    matcher.Compile({ "!" });
+    matcher.Compile({ "/" });
+
+    std::string_view prefix;
+    CHECK(!matcher.Match("!kick", prefix));
+    CHECK(matcher.Match("/kick", prefix) && prefix == "/");
+}
+
+void TestHighBytes()
+{
+    ChatTriggerMatcher matcher;
+    matcher.Compile({ "\xE2\x80\xBA" });
+
+    std::string_view prefix;
+    CHECK(matcher.Match("\xE2\x80\xBAhelp", prefix) && prefix == "\xE2\x80\xBA");
+    CHECK(!matcher.Match("\xE2\x80\xBChelp", prefix));
+}
+
+} // namespace
+
+int main()
+{
+    TestMatchesInConfiguredOrder();
+    TestMultiByteTriggers();
+    TestEmptyTriggerMatchesEverything();
+    TestRecompileReplacesTriggers();
+    TestHighBytes();
+
+    return native_test::Result();
+}
@@ -0,0 +1,133 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/frame_task_queue.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "native_test.h"
+
+using namespace counterstrikesharp;
+
+namespace {
+
+void TestRunsByPriorityThenOrder()
+{
+    FrameTaskQueue queue;
+    std::string order;
+
+    queue.EnqueueLocal([&] { order += 'a'; }, TaskPriority::Low);
+    queue.EnqueueLocal([&] { order += 'b'; }, TaskPriority::Normal);
+    queue.EnqueueLocal([&] { order += 'c'; }, TaskPriority::High);
+    queue.EnqueueLocal([&] { order += 'd'; }, TaskPriority::Normal);
+
+    CHECK_EQ(queue.Run(std::chrono::microseconds(0)), 4);
+    CHECK(order == "cbda");
+    CHECK_EQ(queue.GetDepth(), 0);
+}
+
+void TestTasksQueuedWhileRunningWaitForNextFrame()
+{
+    FrameTaskQueue queue;
+    int ran = 0;
+
+    queue.EnqueueLocal([&] {
+        ran++;
+        queue.EnqueueLocal([&] { ran++; });
+    });
+
+    CHECK_EQ(queue.Run(std::chrono::microseconds(0)), 1);
+    CHECK_EQ(ran, 1);
+    CHECK_EQ(queue.Run(std::chrono::microseconds(0)), 1);
+    CHECK_EQ(ran, 2);
+}
+
+void TestCrossThreadTasksNeedDrain()
+{
+    FrameTaskQueue queue;
+    int ran = 0;
+
+    std::thread producer([&] {
+        for (int i = 0; i < 500; i++)
+        {
+            queue.Enqueue([&] { ran++; });
+        }
+    });
+    producer.join();
+
+    CHECK_EQ(queue.Run(std::chrono::microseconds(0)), 0);
+    queue.Drain();
+    CHECK_EQ(queue.Run(std::chrono::microseconds(0)), 500);
+    CHECK_EQ(ran, 500);
+}
+
+void TestBudgetDefersLowerPriorities()
+{
+    FrameTaskQueue queue;
+    std::string order;
+    const auto slow = [] { std::this_thread::sleep_for(std::chrono::milliseconds(2)); };
+
+    queue.EnqueueLocal([&] { slow(); order += 'h'; }, TaskPriority::High);
+    queue.EnqueueLocal([&] { slow(); order += 'H'; }, TaskPriority::High);
+    queue.EnqueueLocal([&] { order += 'n'; }, TaskPriority::Normal);
+    queue.EnqueueLocal([&] { order += 'l'; }, TaskPriority::Low);
+
+    // High priority tasks run regardless of the budget; the rest carry over, in order.
+    CHECK_EQ(queue.Run(std::chrono::microseconds(500)), 2);
+    CHECK(order == "hH");
+    CHECK_EQ(queue.GetOverrunCount(), 1);
+    CHECK_EQ(queue.GetDeferredCount(), 2);
+    CHECK_EQ(queue.GetPeakDepth(), 4);
+
+    CHECK_EQ(queue.Run(std::chrono::microseconds(500)), 2);
+    CHECK(order == "hHnl");
+}
+
+void TestBudgetAlwaysMakesProgress()
+{
+    FrameTaskQueue queue;
+    int ran = 0;
+
+    for (int i = 0; i < 3; i++)
+    {
+        queue.EnqueueLocal([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            ran++;
+        });
+    }
+
+    // A budget smaller than any one task still runs one task per frame.
+    for (int frame = 1; frame <= 3; frame++)
+    {
+        CHECK_EQ(queue.Run(std::chrono::microseconds(1)), 1);
+        CHECK_EQ(ran, frame);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    TestRunsByPriorityThenOrder();
+    TestTasksQueuedWhileRunningWaitForNextFrame();
+    TestCrossThreadTasksNeedDrain();
+    TestBudgetDefersLowerPriorities();
+    TestBudgetAlwaysMakesProgress();
+
+    return native_test::Result();
+}
@@ -0,0 +1,255 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+// Benchmarks for the SDK-free parts of the native core. Each one compares the current code against the approach it
+// replaced, which is reproduced here, and checks that both give the same answers.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/case_insensitive_hash_map.h"
+#include "core/chat_trigger_matcher.h"
+#include "core/signature_scanner.h"
+#include "native_test.h"
+
+using namespace counterstrikesharp;
+using namespace counterstrikesharp::modules;
+
+namespace {
+
+// Keeps the optimizer from discarding results.
+volatile size_t g_sink;
+
+// Signature scanning: 100 patterns over a synthetic 50 MB module.
+void BenchmarkSignatureScan()
+{
+    constexpr size_t kSize = 50 << 20;
+    constexpr int kPatterns = 100;
+    static constexpr uint8_t kCommon[] = { 0x00, 0xFF, 0x48, 0x89, 0x8B, 0x0F, 0xE8, 0x24, 0x4C, 0x44 };
+
+    std::mt19937 rng(1);
+    std::vector<uint8_t> data(kSize);
+    for (auto& byte : data)
+    {
+        byte = rng() % 3 ? kCommon[rng() % std::size(kCommon)] : static_cast<uint8_t>(rng());
+    }
+
+    // Most patterns are cut from the module with some wildcards; a few are missing, which costs a full pass each.
+    std::vector<std::unique_ptr<SignaturePattern>> patterns;
+    std::vector<const SignaturePattern*> batch;
+    for (int i = 0; i < kPatterns; i++)
+    {
+        const size_t length = 12 + rng() % 24;
+        const size_t offset = rng() % (kSize - length);
+        std::vector<int16_t> bytes;
+        for (size_t j = 0; j < length; j++)
+        {
+            if (i % 20 == 0)
+                bytes.push_back(static_cast<int16_t>(rng() & 0xFF));
+            else
+                bytes.push_back(rng() % 5 == 0 ? int16_t{ -1 } : int16_t{ data[offset + j] });
+        }
+        patterns.push_back(std::make_unique<SignaturePattern>(std::move(bytes)));
+        batch.push_back(patterns.back().get());
+    }
+
+    // What CModule::FindSignature did before: std::find on the first byte, then compare the rest, one pass per pattern.
+    std::vector<size_t> scalar(kPatterns, SignaturePattern::npos);
+    const auto scalarMs = native_test::TimeMilliseconds([&] {
+        for (int i = 0; i < kPatterns; i++)
+        {
+            const auto& bytes = patterns[i]->bytes;
+            const auto* end = data.data() + kSize - bytes.size() + 1;
+            for (const auto* it = data.data(); it < end; it++)
+            {
+                if (bytes[0] != -1)
+                {
+                    it = std::find(it, end, static_cast<uint8_t>(bytes[0]));
+                    if (it == end) break;
+                }
+                if (patterns[i]->Matches(it))
+                {
+                    scalar[i] = static_cast<size_t>(it - data.data());
+                    break;
+                }
+            }
+        }
+    });
+
+    std::vector<size_t> single(kPatterns, SignaturePattern::npos);
+    const auto singleMs = native_test::TimeMilliseconds([&] {
+        for (int i = 0; i < kPatterns; i++)
+        {
+            single[i] = ScanForPattern(data.data(), kSize, *patterns[i]);
+        }
+    });
+
+    std::vector<size_t> batched(kPatterns, SignaturePattern::npos);
+    const auto batchMs = native_test::TimeMilliseconds([&] { ScanForPatterns(data.data(), kSize, batch, batched); });
+
+    CHECK(single == scalar);
+    CHECK(batched == scalar);
+
+    std::printf("signature scan, 50 MB, %d patterns:\n", kPatterns);
+    std::printf("  first-byte find, one pass each   %8.1f ms\n", scalarMs);
+    std::printf("  ScanForPattern, one pass each    %8.1f ms\n", singleMs);
+    std::printf("  ScanForPatterns, single pass     %8.1f ms\n", batchMs);
+}
+
+// Console command lookup: 10k dispatches against a few hundred registered commands.
+void BenchmarkCommandLookup()
+{
+    constexpr int kDispatches = 10000;
+
+    // The map ConCommandManager used before, looked up the way ExecuteCommandCallbacks did.
+    struct CaseInsensitiveComparator
+    {
+        bool operator()(const std::string& lhs, const std::string& rhs) const
+        {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                [](char a, char b) { return std::tolower(a) < std::tolower(b); });
+        }
+    };
+
+    std::vector<std::string> commands;
+    for (int i = 0; i < 400; i++)
+    {
+        commands.push_back("css_command_" + std::to_string(i));
+    }
+
+    std::vector<std::string> dispatched;
+    std::mt19937 rng(2);
+    for (int i = 0; i < kDispatches; i++)
+    {
+        auto name = i % 10 == 0 ? "unknown_" + std::to_string(i) : commands[rng() % commands.size()];
+        if (i % 3 == 0) std::transform(name.begin(), name.end(), name.begin(), [](char c) { return std::toupper(c); });
+        dispatched.push_back(std::move(name));
+    }
+
+    std::map<std::string, int*, CaseInsensitiveComparator> oldLookup;
+    CaseInsensitiveHashMap<int*> newLookup;
+    static int info[400];
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        oldLookup[commands[i]] = &info[i];
+        newLookup.Insert(commands[i], &info[i]);
+    }
+
+    size_t oldHits = 0;
+    const auto oldMs = native_test::TimeMilliseconds([&] {
+        for (const auto& name : dispatched)
+        {
+            const char* raw = name.c_str();
+            if (oldLookup[std::string(raw)] != nullptr) oldHits++;
+        }
+    });
+
+    size_t newHits = 0;
+    const auto newMs = native_test::TimeMilliseconds([&] {
+        for (const auto& name : dispatched)
+        {
+            if (auto found = newLookup.Find(std::string_view(name.c_str())); found && *found) newHits++;
+        }
+    });
+
+    CHECK_EQ(newHits, oldHits);
+    g_sink = oldLookup.size();
+
+    std::printf("command lookup, %d dispatches:\n", kDispatches);
+    std::printf("  std::map operator[]              %8.3f ms (%zu entries afterwards)\n", oldMs, oldLookup.size());
+    std::printf("  CaseInsensitiveHashMap::Find     %8.3f ms\n", newMs);
+}
+
+// Chat trigger matching: a spam burst of 200k chat lines, most of them not commands.
+void BenchmarkChatTriggers()
+{
+    constexpr int kMessages = 200000;
+
+    const std::vector<std::string> triggers = { "!", ".", "?", "css_" };
+    std::vector<std::string> messages;
+    std::mt19937 rng(3);
+    for (int i = 0; i < kMessages; i++)
+    {
+        switch (rng() % 4)
+        {
+            case 0:
+                messages.push_back("!rtv");
+                break;
+            case 1:
+                messages.push_back("css_admin kick someone");
+                break;
+            default:
+                messages.push_back("gg wp everyone " + std::to_string(i));
+                break;
+        }
+    }
+
+    // CCoreConfig::IsTriggerInternal before: the trigger list passed by value for every message.
+    const auto isTriggerInternal = [](std::vector<std::string> list, const std::string& message, std::string& prefix) {
+        for (std::string& trigger : list)
+        {
+            if (message.rfind(trigger, 0) == 0)
+            {
+                prefix = trigger;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    size_t oldMatches = 0;
+    const auto oldMs = native_test::TimeMilliseconds([&] {
+        std::string prefix;
+        for (const auto& message : messages)
+        {
+            if (isTriggerInternal(triggers, message, prefix)) oldMatches += prefix.size();
+        }
+    });
+
+    ChatTriggerMatcher matcher;
+    matcher.Compile(triggers);
+    size_t newMatches = 0;
+    const auto newMs = native_test::TimeMilliseconds([&] {
+        std::string_view prefix;
+        for (const auto& message : messages)
+        {
+            if (matcher.Match(message, prefix)) newMatches += prefix.size();
+        }
+    });
+
+    CHECK_EQ(newMatches, oldMatches);
+
+    std::printf("chat triggers, %d messages:\n", kMessages);
+    std::printf("  trigger list copied per message  %8.3f ms\n", oldMs);
+    std::printf("  ChatTriggerMatcher::Match        %8.3f ms\n", newMs);
+}
+
+} // namespace
+
+int main()
+{
+    BenchmarkSignatureScan();
+    BenchmarkCommandLookup();
+    BenchmarkChatTriggers();
+
+    return native_test::Result();
+}
@@ -0,0 +1,64 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+// Minimal checks for the native tests; each test is its own executable, so the first failures are all ctest needs.
+namespace native_test {
+
+inline int failures = 0;
+
+inline int Result()
+{
+    if (failures > 0) std::fprintf(stderr, "%d check(s) failed\n", failures);
+    return failures > 0 ? 1 : 0;
+}
+
+// Runs fn once and returns how long it took, in milliseconds.
+template <typename Fn> double TimeMilliseconds(Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace native_test
+
+#define CHECK(expr)                                                                       \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(expr))                                                                      \
+        {                                                                                 \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            native_test::failures++;                                                      \
+        }                                                                                 \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                                       \
+    do                                                                                                                   \
+    {                                                                                                                    \
+        const auto checkActual = static_cast<long long>(actual);                                                         \
+        const auto checkExpected = static_cast<long long>(expected);                                                     \
+        if (checkActual != checkExpected)                                                                                \
+        {                                                                                                                \
+            std::fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #actual, #expected, \
+                         checkActual, checkExpected);                                                                    \
+            native_test::failures++;                                                                                     \
+        }                                                                                                                \
+    } while (0)
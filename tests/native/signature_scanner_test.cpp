@@ -0,0 +1,185 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/signature_scanner.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "native_test.h"
+
+using namespace counterstrikesharp::modules;
+
+namespace {
+
+// Straightforward reference: the first offset at which every fixed byte matches.
+size_t NaiveScan(const std::vector<uint8_t>& data, const SignaturePattern& pattern)
+{
+    const auto length = pattern.bytes.size();
+    if (length == 0 || data.size() < length) return SignaturePattern::npos;
+
+    for (size_t offset = 0; offset + length <= data.size(); offset++)
+    {
+        if (pattern.Matches(data.data() + offset)) return offset;
+    }
+
+    return SignaturePattern::npos;
+}
+
+// Skewed towards bytes that are common in x86-64 code, so anchors hit often and the verify path gets exercised.
+std::vector<uint8_t> MakeData(std::mt19937& rng, size_t size)
+{
+    static constexpr uint8_t kCommon[] = { 0x00, 0xFF, 0x48, 0x89, 0x8B, 0x0F, 0xE8, 0x24, 0x4C, 0x44 };
+
+    std::vector<uint8_t> data(size);
+    for (auto& byte : data)
+    {
+        byte = rng() % 3 ? kCommon[rng() % std::size(kCommon)] : static_cast<uint8_t>(rng());
+    }
+    return data;
+}
+
+// A pattern cut from data at offset (so it is guaranteed to match there), with some bytes turned into wildcards.
+std::vector<int16_t> CutPattern(std::mt19937& rng, const std::vector<uint8_t>& data, size_t offset, size_t length, unsigned wildcardPercent)
+{
+    std::vector<int16_t> bytes;
+    for (size_t i = 0; i < length; i++)
+    {
+        bytes.push_back(rng() % 100 < wildcardPercent ? int16_t{ -1 } : int16_t{ data[offset + i] });
+    }
+    return bytes;
+}
+
+std::vector<int16_t> RandomPattern(std::mt19937& rng, size_t length)
+{
+    std::vector<int16_t> bytes;
+    for (size_t i = 0; i < length; i++)
+    {
+        bytes.push_back(rng() % 8 == 0 ? int16_t{ -1 } : static_cast<int16_t>(rng() & 0xFF));
+    }
+    return bytes;
+}
+
+void CheckAgainstReference(const std::vector<uint8_t>& data, const std::vector<std::unique_ptr<SignaturePattern>>& patterns)
+{
+    std::vector<const SignaturePattern*> batch;
+    for (const auto& pattern : patterns)
+    {
+        batch.push_back(pattern.get());
+    }
+
+    std::vector<size_t> results(batch.size(), SignaturePattern::npos);
+    ScanForPatterns(data.data(), data.size(), batch, results);
+
+    for (size_t i = 0; i < patterns.size(); i++)
+    {
+        const auto expected = NaiveScan(data, *patterns[i]);
+        CHECK_EQ(ScanForPattern(data.data(), data.size(), *patterns[i]), expected);
+        CHECK_EQ(results[i], expected);
+    }
+}
+
+void TestRandomPatterns()
+{
+    std::mt19937 rng(1234);
+
+    for (int round = 0; round < 4; round++)
+    {
+        const auto data = MakeData(rng, 1 << 20);
+
+        std::vector<std::unique_ptr<SignaturePattern>> patterns;
+        for (int i = 0; i < 200; i++)
+        {
+            const size_t length = 1 + rng() % 48;
+            std::vector<int16_t> bytes;
+            switch (i % 4)
+            {
+                case 0:
+                    bytes = RandomPattern(rng, length);
+                    break;
+                case 1:
+                    // Right at the end, where the vector loops hand over to the scalar tail.
+                    bytes = CutPattern(rng, data, data.size() - length - rng() % 40, length, 20);
+                    break;
+                default:
+                    bytes = CutPattern(rng, data, rng() % (data.size() - length), length, 20);
+                    break;
+            }
+            patterns.push_back(std::make_unique<SignaturePattern>(std::move(bytes)));
+        }
+
+        CheckAgainstReference(data, patterns);
+    }
+}
+
+void TestSmallInputs()
+{
+    std::mt19937 rng(99);
+
+    // Sizes around and below the vector widths, so every scan is mostly or entirely tail.
+    for (size_t size = 0; size < 130; size++)
+    {
+        const auto data = MakeData(rng, size);
+
+        std::vector<std::unique_ptr<SignaturePattern>> patterns;
+        for (int i = 0; i < 20; i++)
+        {
+            const size_t length = 1 + rng() % 8;
+            if (size >= length && i % 2 == 0)
+            {
+                patterns.push_back(std::make_unique<SignaturePattern>(CutPattern(rng, data, rng() % (size - length + 1), length, 30)));
+            }
+            else
+            {
+                patterns.push_back(std::make_unique<SignaturePattern>(RandomPattern(rng, length)));
+            }
+        }
+
+        CheckAgainstReference(data, patterns);
+    }
+}
+
+void TestEdgeCases()
+{
+    const std::vector<uint8_t> data = { 0x10, 0x20, 0x30, 0x40, 0x20, 0x30 };
+
+    CHECK(SignaturePattern({}).anchorOffset == SignaturePattern::npos);
+    CHECK_EQ(ScanForPattern(data.data(), data.size(), SignaturePattern({})), SignaturePattern::npos);
+    CHECK_EQ(ScanForPattern(data.data(), data.size(), SignaturePattern({ -1, -1 })), 0);
+    CHECK_EQ(ScanForPattern(data.data(), data.size(), SignaturePattern({ 0x20, 0x30 })), 1);
+    CHECK_EQ(ScanForPattern(data.data(), data.size(), SignaturePattern({ -1, 0x20, 0x30 })), 0);
+    CHECK_EQ(ScanForPattern(data.data(), data.size(), SignaturePattern({ 0x30, -1, -1, -1, -1 })), SignaturePattern::npos);
+
+    // Entries that are already resolved are left alone.
+    SignaturePattern pattern({ 0x40, 0x20 });
+    std::vector<const SignaturePattern*> batch = { &pattern, &pattern };
+    std::vector<size_t> results = { 5, SignaturePattern::npos };
+    ScanForPatterns(data.data(), data.size(), batch, results);
+    CHECK_EQ(results[0], 5);
+    CHECK_EQ(results[1], 3);
+}
+
+} // namespace
+
+int main()
+{
+    TestEdgeCases();
+    TestSmallInputs();
+    TestRandomPatterns();
+
+    return native_test::Result();
+}
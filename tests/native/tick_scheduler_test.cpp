@@ -0,0 +1,146 @@
+/*
+ *  This file is part of CounterStrikeSharp.
+ *  CounterStrikeSharp is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  CounterStrikeSharp is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with CounterStrikeSharp.  If not, see <https://www.gnu.org/licenses/>. *
+ */
+
+#include "core/tick_scheduler.h"
+
+#include <thread>
+#include <vector>
+
+#include "native_test.h"
+
+using namespace counterstrikesharp;
+
+namespace {
+
+// Runs the callbacks due at tick and returns how many there were.
+size_t RunTick(TickScheduler& scheduler, int tick)
+{
+    std::vector<std::function<void()>> callbacks;
+    scheduler.getCallbacks(tick, callbacks);
+    for (auto& callback : callbacks)
+    {
+        callback();
+    }
+    return callbacks.size();
+}
+
+void TestRunsOnRequestedTick()
+{
+    TickScheduler scheduler;
+    std::vector<int> ranAt;
+    int tick = 100;
+
+    RunTick(scheduler, tick);
+    for (int delay : { 1, 5, 5, 255, 256, 257, 1000 })
+    {
+        scheduler.schedule(tick + delay, [&ranAt, &tick] { ranAt.push_back(tick); });
+    }
+
+    for (tick = 101; tick <= 1200; tick++)
+    {
+        RunTick(scheduler, tick);
+    }
+
+    const std::vector<int> expected = { 101, 105, 105, 355, 356, 357, 1100 };
+    CHECK(ranAt == expected);
+}
+
+void TestPastTicksRunImmediately()
+{
+    TickScheduler scheduler;
+    RunTick(scheduler, 50);
+
+    int ran = 0;
+    scheduler.schedule(10, [&] { ran++; });
+    scheduler.schedule(51, [&] { ran++; });
+
+    CHECK_EQ(RunTick(scheduler, 51), 2);
+    CHECK_EQ(ran, 2);
+}
+
+void TestSkippedTicksAreCollected()
+{
+    TickScheduler scheduler;
+    RunTick(scheduler, 0);
+
+    int ran = 0;
+    for (int tick = 1; tick <= 600; tick += 7)
+    {
+        scheduler.schedule(tick, [&] { ran++; });
+    }
+
+    // Jumping ahead (e.g. after a hitch) still returns everything that became due.
+    RunTick(scheduler, 1);
+    CHECK_EQ(RunTick(scheduler, 700), 85);
+    CHECK_EQ(ran, 86);
+}
+
+void TestTickGoingBackwardsKeepsAbsoluteTicks()
+{
+    TickScheduler scheduler;
+    RunTick(scheduler, 1000);
+
+    int ran = 0;
+    scheduler.schedule(1010, [&] { ran++; });
+    RunTick(scheduler, 1001);
+
+    // A map change resets the tick count; the callback keeps waiting for tick 1010.
+    CHECK_EQ(RunTick(scheduler, 1), 0);
+    CHECK_EQ(RunTick(scheduler, 1009), 0);
+    CHECK_EQ(RunTick(scheduler, 1010), 1);
+    CHECK_EQ(ran, 1);
+}
+
+void TestScheduleFromOtherThreads()
+{
+    TickScheduler scheduler;
+    RunTick(scheduler, 0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&scheduler, t] {
+            for (int i = 0; i < 1000; i++)
+            {
+                scheduler.schedule(1 + (i + t) % 400, [] {});
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    size_t ran = 0;
+    for (int tick = 1; tick <= 400; tick++)
+    {
+        ran += RunTick(scheduler, tick);
+    }
+    CHECK_EQ(ran, 4000);
+}
+
+} // namespace
+
+int main()
+{
+    TestRunsOnRequestedTick();
+    TestPastTicksRunImmediately();
+    TestSkippedTicksAreCollected();
+    TestTickGoingBackwardsKeepsAbsoluteTicks();
+    TestScheduleFromOtherThreads();
+
+    return native_test::Result();
+}